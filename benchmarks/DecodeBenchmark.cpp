@@ -0,0 +1,200 @@
+// Copyright (c) embedded ocean GmbH
+#include "ByteOrder.hpp"
+#include "DataAddress.hpp"
+#include "DecodeKernels.hpp"
+#include "PerValueReadState.hpp"
+#include "ReadBatch.hpp"
+#include "ReadCommand.hpp"
+#include "ReadPhaseTimes.hpp"
+#include "Types.hpp"
+
+#include <xentara/memory/Array.hpp>
+#include <xentara/memory/ArrayBlock.hpp>
+#include <xentara/memory/memoryResources.hpp>
+#include <xentara/memory/WriteSentinel.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace xentara::plugins::templateDriver::benchmarks
+{
+
+using namespace std::literals;
+
+namespace
+{
+
+	/// @brief The numbers of values each benchmark is run with
+	constexpr std::array kValueCounts { std::size_t(1'000), std::size_t(10'000), std::size_t(100'000) };
+
+	/// @brief The number of values decoded per benchmark, so that small payloads are repeated often enough to be measurable
+	constexpr std::size_t kValuesPerBenchmark = 50'000'000;
+
+	/// @brief The fraction of values that change between two reads, in percent
+	constexpr std::size_t kChangedPercent = 10;
+
+	/// @brief The instruction sets to benchmark, together with their names
+	constexpr std::array kInstructionSets {
+		std::pair { kernels::InstructionSet::Scalar, "scalar"sv },
+		std::pair { kernels::InstructionSet::Sse41, "sse4.1"sv },
+		std::pair { kernels::InstructionSet::Avx2, "avx2"sv } };
+
+	/// @brief Creates a payload of random bytes
+	auto makePayload(std::size_t size, std::mt19937_64 &random) -> std::vector<std::byte>
+	{
+		std::vector<std::byte> payload(size);
+		std::ranges::generate(payload, [&] { return std::byte(random()); });
+		return payload;
+	}
+
+	/// @brief Changes a fraction of the values in a payload
+	auto changeValues(std::span<std::byte> payload, std::size_t valueSize, std::mt19937_64 &random) -> void
+	{
+		const auto valueCount = payload.size() / valueSize;
+		for (std::size_t index = 0; index < valueCount * kChangedPercent / 100; ++index)
+		{
+			payload[(random() % valueCount) * valueSize] ^= std::byte(1);
+		}
+	}
+
+	/// @brief Runs a function repeatedly, and prints the average time per value
+	/// @param name The name of the benchmark
+	/// @param instructionSet The name of the instruction set
+	/// @param valueCount The number of values the function processes in each call
+	/// @param function The function to run
+	template <std::invocable Function>
+	auto measure(std::string_view name, std::string_view instructionSet, std::size_t valueCount, Function &&function) -> void
+	{
+		// Warm up the caches
+		function();
+
+		const auto repetitions = std::max(kValuesPerBenchmark / valueCount, std::size_t(1));
+		const auto start = std::chrono::steady_clock::now();
+		for (std::size_t repetition = 0; repetition < repetitions; ++repetition)
+		{
+			function();
+		}
+		const std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+
+		std::printf("%-24.*s %-8.*s %8zu values %10.3f ns/value\n",
+			int(name.size()), name.data(),
+			int(instructionSet.size()), instructionSet.data(),
+			valueCount,
+			duration.count() / double(repetitions * valueCount));
+	}
+
+	/// @brief Benchmarks the kernels on their own
+	auto benchmarkKernels(std::string_view instructionSet, std::size_t valueCount) -> void
+	{
+		std::mt19937_64 random { valueCount };
+
+		// Byte order conversion of big endian 32 bit values
+		const auto payload = makePayload(valueCount * sizeof(std::uint32_t), random);
+		std::vector<std::byte> converted(payload.size());
+		const kernels::ByteShuffle shuffle { sizeof(std::uint32_t), ByteOrder::BigEndian };
+		measure("toNativeByteOrder<u32>", instructionSet, valueCount, [&] {
+			kernels::toNativeByteOrder(payload, converted.data(), shuffle);
+		});
+
+		// Widening 16 bit values to 32 bits
+		std::vector<std::int32_t> widened(valueCount);
+		measure("widen<i16,i32>", instructionSet, valueCount, [&] {
+			kernels::widen(payload.data(), sizeof(std::int16_t), widened.data(), valueCount);
+		});
+
+		// Change detection of 32 bit values, with some of the values changed
+		std::vector<std::int32_t> oldValues(valueCount);
+		std::memcpy(oldValues.data(), payload.data(), valueCount * sizeof(std::int32_t));
+		auto newValues = oldValues;
+		changeValues(std::as_writable_bytes(std::span(newValues)), sizeof(std::int32_t), random);
+		std::vector<std::uint64_t> changes((valueCount + 63) / 64);
+		measure("findChanges<i32>", instructionSet, valueCount, [&] {
+			std::ranges::fill(changes, 0);
+			kernels::findChanges(newValues.data(), oldValues.data(), valueCount, changes.data());
+		});
+	}
+
+	/// @brief Benchmarks the update of a read batch of big endian 32 bit values at adjacent addresses
+	///
+	/// This includes decoding the values using the kernels, detecting the changes, and updating the read states of the
+	/// values that changed.
+	auto benchmarkBatchUpdate(std::string_view instructionSet, std::size_t valueCount) -> void
+	{
+		std::mt19937_64 random { valueCount };
+
+		// Create the read states and the batch
+		memory::Array dataArray;
+		std::size_t eventCount { 0 };
+		auto states = std::make_unique<PerValueReadState<std::int32_t>[]>(valueCount);
+		ReadBatch<std::int32_t> batch;
+		for (std::size_t index = 0; index < valueCount; ++index)
+		{
+			states[index].attach(dataArray, eventCount);
+			batch.add(states[index],
+				DataAddress { ._address = index * sizeof(std::int32_t), ._size = sizeof(std::int32_t), ._byteOrder = ByteOrder::BigEndian });
+		}
+
+		// Create the read command and fill in a payload
+		ReadCommand command { 0, valueCount * sizeof(std::int32_t) };
+		const auto receiveBuffer = command.receiveBuffer();
+		const auto data = makePayload(receiveBuffer.size(), random);
+		std::ranges::copy(data, receiveBuffer.begin());
+		batch.prepare(command);
+		const auto payload = command.payload(receiveBuffer.size());
+
+		// Create the data block and the buffers
+		DataBlock dataBlock { dataArray };
+		dataBlock.create(memory::memoryResources::data());
+		PendingEventList eventsToRaise;
+		eventsToRaise.reset(eventCount);
+		ReadPhaseTimes phaseTimes;
+
+		measure("ReadBatch::update<i32>", instructionSet, valueCount, [&] {
+			// Change some of the values, like a real process would between two reads
+			changeValues(receiveBuffer, sizeof(std::int32_t), random);
+
+			const auto timeStamp = std::chrono::system_clock::now();
+			memory::WriteSentinel sentinel { dataBlock };
+			batch.update(sentinel, timeStamp, std::cref(payload), {}, eventsToRaise, phaseTimes);
+			sentinel.commit(timeStamp, eventsToRaise);
+			eventsToRaise.clear();
+		});
+	}
+
+} // namespace
+
+} // namespace xentara::plugins::templateDriver::benchmarks
+
+auto main() -> int
+{
+	using namespace xentara::plugins::templateDriver;
+	using namespace xentara::plugins::templateDriver::benchmarks;
+
+	for (auto &&[instructionSet, name] : kInstructionSets)
+	{
+		// Skip instruction sets the processor does not support
+		if (kernels::selectInstructionSet(instructionSet) != instructionSet)
+		{
+			std::printf("%-24s %-8.*s not supported by this processor\n", "", int(name.size()), name.data());
+			continue;
+		}
+
+		for (auto valueCount : kValueCounts)
+		{
+			benchmarkKernels(name, valueCount);
+			benchmarkBatchUpdate(name, valueCount);
+		}
+	}
+
+	return 0;
+}
\ No newline at end of file
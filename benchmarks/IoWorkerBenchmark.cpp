@@ -0,0 +1,215 @@
+// Copyright (c) embedded ocean GmbH
+#include "AbstractIoConnection.hpp"
+#include "AbstractIoRequest.hpp"
+#include "IoCompletionRing.hpp"
+#include "IoPriority.hpp"
+#include "IoQueueStatistics.hpp"
+#include "IoWorker.hpp"
+#include "ThreadOptions.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace xentara::plugins::templateDriver::benchmarks
+{
+
+using namespace std::literals;
+
+namespace
+{
+
+	/// @brief The numbers of connections each benchmark is run with
+	constexpr std::array kConnectionCounts { std::size_t(1'000), std::size_t(3'000), std::size_t(10'000) };
+
+	/// @brief The number of requests executed per benchmark
+	constexpr std::size_t kRequestsPerBenchmark = 100'000;
+
+	/// @brief A simulated connection to an I/O component that responds to each request right away
+	///
+	/// The responses are signalled using an event file descriptor in semaphore mode, which becomes readable for each response
+	/// that is ready, like the socket of a real connection would.
+	class SimulatedConnection final : public AbstractIoConnection
+	{
+	public:
+		/// @brief Constructor
+		/// @param usePollHandle Whether to publish the event file descriptor as poll handle
+		SimulatedConnection(bool usePollHandle) : _usePollHandle(usePollHandle)
+		{
+			if (_event < 0)
+			{
+				throw std::system_error(errno, std::generic_category(), "could not create the event of a simulated connection");
+			}
+		}
+
+		/// @brief The destructor closes the event
+		~SimulatedConnection()
+		{
+			::close(_event);
+		}
+
+		/// @brief Sends a request, and makes its response ready
+		auto send(std::uint32_t requestId) -> void
+		{
+			_pendingResponses.push_back(requestId);
+			const std::uint64_t increment { 1 };
+			static_cast<void>(::write(_event, &increment, sizeof(increment)));
+		}
+
+		auto pollHandle() const noexcept -> int final
+		{
+			return _usePollHandle ? _event : -1;
+		}
+
+		auto receiveResponseId() -> std::uint32_t final
+		{
+			std::uint64_t count { 0 };
+			if (::read(_event, &count, sizeof(count)) < 0)
+			{
+				throw std::system_error(errno, std::generic_category(), "could not receive from a simulated connection");
+			}
+			const auto requestId = _pendingResponses.front();
+			_pendingResponses.pop_front();
+			return requestId;
+		}
+
+		auto skipResponse() -> void final
+		{
+		}
+
+	private:
+		/// @brief The event that signals ready responses
+		int _event { ::eventfd(0, EFD_CLOEXEC | EFD_SEMAPHORE) };
+		/// @brief Whether the event is published as poll handle
+		bool _usePollHandle { true };
+		/// @brief The IDs of the requests whose responses are ready. This is only used by the I/O worker thread.
+		std::deque<std::uint32_t> _pendingResponses;
+	};
+
+	/// @brief A request sent over a simulated connection
+	class SimulatedRequest final : public AbstractIoRequest
+	{
+	public:
+		/// @brief Constructor
+		SimulatedRequest(SimulatedConnection &connection, IoCompletionRing &completions) :
+			_connection(connection), _completions(completions)
+		{
+		}
+
+		auto connection() noexcept -> AbstractIoConnection & final
+		{
+			return _connection;
+		}
+
+		auto send(std::uint32_t requestId) noexcept -> bool final
+		{
+			_connection.send(requestId);
+			return true;
+		}
+
+		auto receive() noexcept -> void final
+		{
+			_completions.push(*this);
+		}
+
+		auto fail([[maybe_unused]] std::error_code error) noexcept -> void final
+		{
+			_completions.push(*this);
+		}
+
+	private:
+		/// @brief The connection
+		SimulatedConnection &_connection;
+		/// @brief The ring to report the completion to
+		IoCompletionRing &_completions;
+	};
+
+	/// @brief Executes requests over a number of simulated connections, one request per connection and cycle, like a polling
+	/// cycle of I/O transactions that each read from their own I/O component
+	/// @param connectionCount The number of connections
+	/// @param usePollHandles Whether the connections have poll handles, so that the worker can wait for them using epoll
+	auto benchmarkConnections(std::size_t connectionCount, bool usePollHandles) -> void
+	{
+		// Create the connections and the requests
+		std::vector<std::unique_ptr<SimulatedConnection>> connections;
+		std::vector<std::unique_ptr<SimulatedRequest>> requests;
+		IoCompletionRing completions;
+		completions.reset(connectionCount);
+		connections.reserve(connectionCount);
+		requests.reserve(connectionCount);
+		for (std::size_t index = 0; index < connectionCount; ++index)
+		{
+			connections.push_back(std::make_unique<SimulatedConnection>(usePollHandles));
+			requests.push_back(std::make_unique<SimulatedRequest>(*connections.back(), completions));
+		}
+
+		// Start the worker
+		IoWorker worker;
+		IoQueueStatistics statistics;
+		for (auto &&connection : connections)
+		{
+			worker.addConnection(*connection, 1);
+		}
+		worker.start(connectionCount, IoPriorityWeights {}, ThreadOptions {});
+		worker.addStatistics(statistics);
+
+		// Run the cycles
+		const auto cycles = std::max(kRequestsPerBenchmark / connectionCount, std::size_t(1));
+		const auto start = std::chrono::steady_clock::now();
+		for (std::size_t cycle = 0; cycle < cycles; ++cycle)
+		{
+			for (auto &&request : requests)
+			{
+				worker.submit(*request, IoPriority::Normal, statistics);
+			}
+			for (std::size_t index = 0; index < connectionCount; ++index)
+			{
+				completions.wait();
+			}
+		}
+		const std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+
+		// The worker records its CPU time before it becomes idle, so stopping it makes sure the time includes all the cycles
+		worker.stop();
+		worker.removeStatistics(statistics);
+		const auto requestCount = double(cycles * connectionCount);
+		const auto cpuTime = statistics.threadCpuTime().load() * 1e9;
+
+		const auto mode = usePollHandles ? "epoll"sv : "blocking"sv;
+		std::printf("IoWorker %-8.*s %6zu connections %10.3f us/cycle %10.1f ns/request %10.1f ns CPU/request\n",
+			int(mode.size()), mode.data(),
+			connectionCount,
+			duration.count() / double(cycles) / 1000.0,
+			duration.count() / requestCount,
+			cpuTime / requestCount);
+	}
+
+} // namespace
+
+} // namespace xentara::plugins::templateDriver::benchmarks
+
+auto main() -> int
+{
+	using namespace xentara::plugins::templateDriver::benchmarks;
+
+	for (auto usePollHandles : { true, false })
+	{
+		for (auto connectionCount : kConnectionCounts)
+		{
+			benchmarkConnections(connectionCount, usePollHandles);
+		}
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,169 @@
+// Copyright (c) embedded ocean GmbH
+#include "ByteOrder.hpp"
+#include "DataAddress.hpp"
+#include "DecodePool.hpp"
+#include "PerValueReadState.hpp"
+#include "ReadOperation.hpp"
+#include "ReadPhaseTimes.hpp"
+#include "ThreadOptions.hpp"
+#include "Types.hpp"
+
+#include <xentara/memory/Array.hpp>
+#include <xentara/memory/ArrayBlock.hpp>
+#include <xentara/memory/memoryResources.hpp>
+#include <xentara/memory/WriteSentinel.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <span>
+#include <thread>
+
+namespace xentara::plugins::templateDriver::benchmarks
+{
+
+namespace
+{
+
+	/// @brief The numbers of values each benchmark is run with. All the values are read by a single read command.
+	constexpr std::array kValueCounts { std::size_t(100'000), std::size_t(1'000'000) };
+
+	/// @brief The maximum number of threads to use
+	constexpr std::size_t kMaxThreads = 16;
+
+	/// @brief The number of values updated per measurement
+	constexpr std::size_t kValuesPerBenchmark = 20'000'000;
+
+	/// @brief The fraction of values that change between two reads, in percent
+	constexpr std::size_t kChangedPercent = 10;
+
+	/// @brief Benchmarks the parallel update of the inputs of a single read operation with big endian 32 bit values
+	/// @param valueCount The number of values
+	/// @param threadCount The number of threads, including the calling thread
+	/// @return The average time per value, in nanoseconds
+	///
+	/// The inputs are updated the same way TemplateIoTransaction::updateInputs() does it.
+	auto benchmarkParallelUpdate(std::size_t valueCount, std::size_t threadCount) -> double
+	{
+		std::mt19937_64 random { valueCount };
+
+		// Create the read operation and the read states of the inputs
+		memory::Array dataArray;
+		std::size_t eventCount { 0 };
+		ReadOperation operation { 0, valueCount * sizeof(std::int32_t) };
+		operation.attach(dataArray);
+		auto states = std::make_unique<PerValueReadState<std::int32_t>[]>(valueCount);
+		auto &batch = operation.batches().batch<std::int32_t>();
+		for (std::size_t index = 0; index < valueCount; ++index)
+		{
+			states[index].attach(dataArray, eventCount);
+			batch.add(states[index],
+				DataAddress { ._address = index * sizeof(std::int32_t), ._size = sizeof(std::int32_t), ._byteOrder = ByteOrder::BigEndian });
+		}
+		operation.prepare();
+
+		// Fill in a payload
+		auto &command = operation.command();
+		const auto receiveBuffer = command.receiveBuffer();
+		std::ranges::generate(receiveBuffer, [&] { return std::byte(random()); });
+		const auto payload = command.payload(receiveBuffer.size());
+		operation.setPayload(payload);
+
+		// Create the data block and the buffers for each thread
+		DataBlock dataBlock { dataArray };
+		dataBlock.create(memory::memoryResources::data());
+		auto eventsToRaise = std::make_unique<PendingEventList[]>(threadCount);
+		for (std::size_t index = 0; index < threadCount; ++index)
+		{
+			eventsToRaise[index].reset(eventCount);
+		}
+		auto phaseTimes = std::make_unique<ReadPhaseTimes[]>(threadCount);
+
+		// Start the threads
+		ThreadOptions threadOptions;
+		threadOptions._name = "decode-bench";
+		DecodePool pool { threadOptions };
+		pool.acquire(threadCount - 1);
+
+		// Updates the inputs once
+		const auto update = [&]
+			{
+				// Change some of the values, like a real process would between two reads
+				for (std::size_t index = 0; index < valueCount * kChangedPercent / 100; ++index)
+				{
+					receiveBuffer[(random() % valueCount) * sizeof(std::int32_t)] ^= std::byte(1);
+				}
+
+				const auto timeStamp = std::chrono::system_clock::now();
+				memory::WriteSentinel sentinel { dataBlock };
+				operation.beginUpdate(sentinel, timeStamp);
+				pool.run(operation.chunkCount(), threadCount, [&](std::size_t chunk, std::size_t participant)
+					{
+						operation.updateChunk(chunk, sentinel, timeStamp, eventsToRaise[participant], phaseTimes[participant]);
+					});
+
+				// Merge the events, and commit the data
+				for (std::size_t index = 1; index < threadCount; ++index)
+				{
+					for (auto &&event : eventsToRaise[index])
+					{
+						eventsToRaise[0].push_back(event);
+					}
+					eventsToRaise[index].clear();
+				}
+				sentinel.commit(timeStamp, eventsToRaise[0]);
+				eventsToRaise[0].clear();
+			};
+
+		// Warm up the caches
+		update();
+
+		const auto repetitions = std::max(kValuesPerBenchmark / valueCount, std::size_t(1));
+		const auto start = std::chrono::steady_clock::now();
+		for (std::size_t repetition = 0; repetition < repetitions; ++repetition)
+		{
+			update();
+		}
+		const std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+
+		pool.release();
+
+		return duration.count() / double(repetitions * valueCount);
+	}
+
+} // namespace
+
+} // namespace xentara::plugins::templateDriver::benchmarks
+
+auto main() -> int
+{
+	using namespace xentara::plugins::templateDriver::benchmarks;
+
+	std::printf("%u hardware threads available\n", std::thread::hardware_concurrency());
+
+	for (auto valueCount : kValueCounts)
+	{
+		double singleThreaded { 0.0 };
+		for (std::size_t threadCount = 1; threadCount <= kMaxThreads; ++threadCount)
+		{
+			const auto nanoseconds = benchmarkParallelUpdate(valueCount, threadCount);
+			if (threadCount == 1)
+			{
+				singleThreaded = nanoseconds;
+			}
+
+			std::printf("ReadOperation::updateChunk<i32> %8zu values %2zu threads %10.3f ns/value %6.2fx\n",
+				valueCount,
+				threadCount,
+				nanoseconds,
+				singleThreaded / nanoseconds);
+		}
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief Base class for objects that can write pending output values outside of the regular write cycle
+class AbstractImmediateWriter
+{
+public:
+	/// @brief Virtual destructor
+	/// @note The destructor is pure virtual (= 0) to ensure that this class will remain abstract, even if we should remove all
+	/// other pure virtual functions later. This is not necessary, of course, but prevents the abstract class from becoming
+	/// instantiable by accident as a result of refactoring.
+	virtual ~AbstractImmediateWriter() = 0;
+
+	/// @brief Starts writing a pending output value right away
+	///
+	/// This function is called by the thread that scheduled the output value. It must not wait for the value to be written,
+	/// so that the thread is not held up by the I/O component. The write state is updated once the write has completed.
+	virtual auto writeImmediately() noexcept -> void = 0;
+};
+
+inline AbstractImmediateWriter::~AbstractImmediateWriter() = default;
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -2,21 +2,17 @@
 #pragma once
 
 #include "Types.hpp"
-#include "CommonReadState.hpp"
-#include "ReadCommand.hpp"
+#include "DataAddress.hpp"
 
 #include <xentara/memory/Array.hpp>
-#include <xentara/memory/WriteSentinel.hpp>
-#include <xentara/utils/eh/expected.hpp>
 
-#include <chrono>
-#include <system_error>
 #include <cstdlib>
 
 namespace xentara::plugins::templateDriver
 {
 
 class TemplateIoComponent;
+class ReadOperation;
 
 /// @brief Base class for inputs and outputs that can be read by an I/O transaction
 ///
@@ -43,20 +39,18 @@ public:
 	/// event count to preallocate a buffer when collecting the events to raise after an update.
 	virtual auto attachInput(memory::Array &dataArray, std::size_t &eventCount) -> void = 0;
 
-	/// @brief Updates the read state and collects the events to send
-	/// @param writeSentinel A write sentinel for the data block the data is stored in
-	/// @param timeStamp The update time stamp
-	/// @param payloadOrError This is a variant-like type that will hold either the payload of the read command, or an std::error_code object
-	/// containing a read error.
-	/// @param commonChanges An object containing information about which parts of the common read state changed, if any.
-	/// @param eventsToRaise Any events that need to be raised as a result of the update will be added to this
-	/// list. The events will not be raised directly, because the write sentinel needs to be commited first,
-	/// which is done by the caller.
-	virtual auto updateReadState(WriteSentinel &writeSentinel,
-		std::chrono::system_clock::time_point timeStamp,
-		const utils::eh::expected<std::reference_wrapper<const ReadCommand::Payload>, std::error_code> &payloadOrError,
-		const CommonReadState::Changes &commonChanges,
-		PendingEventList &eventsToRaise) -> void = 0;
+	/// @brief Gets the location of the value within the I/O component
+	virtual auto dataAddress() const -> const DataAddress & = 0;
+
+	/// @brief Gets an index that identifies the value type of the input
+	///
+	/// The I/O transaction uses this to read values of different types using separate commands, if necessary.
+	virtual auto valueTypeIndex() const -> std::size_t = 0;
+
+	/// @brief Adds the read state of the input to the read operation that reads its value
+	/// @param operation The read operation. The input must add its read state to the batch for its value type,
+	/// which will then update the read state together with those of all the other inputs of the same type.
+	virtual auto addToReadOperation(ReadOperation &operation) -> void = 0;
 };
 
 inline AbstractInput::~AbstractInput() = default;
@@ -0,0 +1,52 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <cstdint>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief Base class for connections to I/O components that requests are sent over
+///
+/// The I/O worker uses this interface to match responses to the requests that are in flight on a connection, so that
+/// several requests can be outstanding at the same time, and to find out which connections have responses ready.
+class AbstractIoConnection
+{
+public:
+	/// @brief Virtual destructor
+	/// @note The destructor is pure virtual (= 0) to ensure that this class will remain abstract, even if we should remove all
+	/// other pure virtual functions later. This is not necessary, of course, but prevents the abstract class from becoming
+	/// instantiable by accident as a result of refactoring.
+	virtual ~AbstractIoConnection() = 0;
+
+	/// @brief Gets a file descriptor that becomes readable once a response can be received
+	///
+	/// The I/O worker waits for the file descriptors of all its connections at the same time, and only receives from
+	/// connections that are ready, so that a slow connection does not hold up the responses of the others. The file
+	/// descriptor must not change while the connection is in use.
+	/// @return The file descriptor, or -1 if the connection has none. The I/O worker receives from connections without a
+	/// file descriptor one at a time, blocking until the response arrives.
+	virtual auto pollHandle() const noexcept -> int
+	{
+		return -1;
+	}
+
+	/// @brief Receives the header of the next response, and returns the ID of the request it belongs to
+	///
+	/// The rest of the response is then received by the request with the returned ID, or skipped using skipResponse().
+	/// The I/O worker numbers the requests sent over each connection consecutively, starting at 0 when the connection
+	/// is added to the worker, so a protocol without request IDs can return a running count of the responses received
+	/// since the connection was opened. If the ID does not belong to any request in flight, the requests in flight on the
+	/// connection fail with CustomError::UnexpectedResponse.
+	/// @throw std::system_error The connection failed. All requests in flight fail, and the numbering of the requests starts
+	/// over at 0, so the connection must start counting its responses from 0 again as well.
+	virtual auto receiveResponseId() -> std::uint32_t = 0;
+
+	/// @brief Skips the rest of a response that does not belong to any outstanding request
+	/// @throw std::system_error The connection failed. This has the same effect as an error in receiveResponseId().
+	virtual auto skipResponse() -> void = 0;
+};
+
+inline AbstractIoConnection::~AbstractIoConnection() = default;
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,48 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "AbstractIoConnection.hpp"
+
+#include <cstdint>
+#include <system_error>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief Base class for requests that are executed by the I/O worker of an I/O component
+///
+/// Requests are allocated up front by their owners and are never copied into the queue of the worker, so that submitting
+/// a request does not allocate any memory.
+///
+/// A request is executed in two steps: the worker first sends the request, possibly together with other requests, and then
+/// calls receive() once the header of the matching response has arrived. Every request must report its completion to its
+/// owner exactly once, either from send(), receive(), or fail().
+class AbstractIoRequest
+{
+public:
+	/// @brief Virtual destructor
+	/// @note The destructor is pure virtual (= 0) to ensure that this class will remain abstract, even if we should remove all
+	/// other pure virtual functions later. This is not necessary, of course, but prevents the abstract class from becoming
+	/// instantiable by accident as a result of refactoring.
+	virtual ~AbstractIoRequest() = 0;
+
+	/// @brief Gets the connection the request is sent over
+	virtual auto connection() noexcept -> AbstractIoConnection & = 0;
+
+	/// @brief Sends the request on the I/O worker thread
+	/// @param requestId The ID the response will carry. The IDs are counted per connection, and the ID of a request
+	/// that could not be sent is used again for the next request.
+	/// @return Returns true if the request was sent, or false if an error occurred. In the latter case, the error must
+	/// be recorded in the request, and the completion must be reported before returning.
+	virtual auto send(std::uint32_t requestId) noexcept -> bool = 0;
+
+	/// @brief Receives the rest of the response after its header, and reports the completion
+	virtual auto receive() noexcept -> void = 0;
+
+	/// @brief Records an error that prevented the response from being received, and reports the completion
+	virtual auto fail(std::error_code error) noexcept -> void = 0;
+};
+
+inline AbstractIoRequest::~AbstractIoRequest() = default;
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -3,6 +3,8 @@
 
 #include "Types.hpp"
 #include "CommonReadState.hpp"
+#include "DataAddress.hpp"
+#include "PendingOutputSet.hpp"
 
 #include <xentara/memory/Array.hpp>
 #include <xentara/memory/WriteSentinel.hpp>
@@ -29,14 +31,23 @@ public:
 	/// @brief Gets the I/O component the output belongs to
 	/// @todo give this a more descriptive name, e.g. "_device"
 	virtual auto ioComponent() const -> const TemplateIoComponent & = 0;
+
+	/// @brief Gets the address of the output value within the I/O component
+	virtual auto dataAddress() const -> const DataAddress & = 0;
 		
+	/// @brief Checks whether values written to the output must be sent to the I/O component right away, instead of in
+	/// the next write cycle
+	virtual auto immediateWrite() const -> bool = 0;
+
 	/// @brief Attaches the output to its I/O transaction
 	/// @param dataArray The data array that the attributes should be added to. The caller will use the information in this array
 	/// to allocate the data block.
 	/// @param eventCount A variable that counts the total number of events than can be raised for a single update.
 	/// The maximum number of events that update() will request to be raised will be added to this variable. The caller will use this
 	/// event count to preallocate a buffer when collecting the events to raise after an update.
-	virtual auto attachOutput(memory::Array &dataArray, std::size_t &eventCount) -> void = 0;
+	/// @param pendingMarker The marker the output must use to signal that a value is pending. The I/O transaction
+	/// only checks outputs for pending values if they have been marked.
+	virtual auto attachOutput(memory::Array &dataArray, std::size_t &eventCount, PendingOutputSet::Marker pendingMarker) -> void = 0;
 
 	/// @brief Adds any pending output value to a write command.
 	/// @param command The write command to add the value to.
@@ -3,7 +3,8 @@
 
 #include "Types.hpp"
 #include "CommonReadState.hpp"
-#include "ReadCommand.hpp"
+#include "DataAddress.hpp"
+#include "PendingOutputSet.hpp"
 
 #include <xentara/data/DataType.hpp>
 #include <xentara/data/ReadHandle.hpp>
@@ -19,12 +20,14 @@
 #include <string_view>
 #include <memory>
 #include <chrono>
+#include <cstddef>
 #include <optional>
 
 namespace xentara::plugins::templateDriver
 {
 
 class TemplateIoTransaction;
+class ReadOperation;
 class WriteCommand;
 
 // Base class for data type specific functionality for TemplateOutput.
@@ -41,6 +44,14 @@ public:
 	/// @brief Returns the data type
 	virtual auto dataType() const -> const data::DataType & = 0;
 
+	/// @brief Returns the size the value has in the I/O component by default
+	/// @return The size in bytes, or 0 if there is no default size and the size must be configured explicitly.
+	virtual auto defaultSize() const -> std::size_t = 0;
+
+	/// @brief Checks whether a configured size is valid for the value
+	/// @param size The size in bytes
+	virtual auto isValidSize(std::size_t size) const -> bool = 0;
+
 	/// @brief Iterates over all the attributes.
 	/// @param function The function that should be called for each attribute
 	/// @param ioTransaction The I/O transaction this output is attached to. This is used to handle inherited attributes.
@@ -87,21 +98,14 @@ public:
 	/// event count to preallocate a buffer when collecting the events to raise after an update.
 	virtual auto attachReadState(memory::Array &dataArray, std::size_t &eventCount) -> void = 0;
 
-	/// @brief Updates the read state and collects the events to send
-	/// @param writeSentinel A write sentinel for the data block the data is stored in
-	/// @param timeStamp The update time stamp
-	/// @param payloadOrError This is a variant-like type that will hold either the payload of the read command, or an std::error_code object
-	/// containing a read error.
-	/// @param commonChanges An object containing information about which parts of the common read state changed, if any.
-	/// @param eventsToRaise Any events that need to be raised as a result of the update will be added to this
-	/// list. The events will not be raised directly, because the write sentinel needs to be commited first,
-	/// which is done by the caller.
-	/// @todo add parameters needed to decode the value from the payload of a read command, like e.g. a data offset.
-	virtual auto updateReadState(WriteSentinel &writeSentinel,
-		std::chrono::system_clock::time_point timeStamp,
-		const utils::eh::expected<std::reference_wrapper<const ReadCommand::Payload>, std::error_code> &payloadOrError,
-		const CommonReadState::Changes &commonChanges,
-		PendingEventList &eventsToRaise) -> void = 0;
+	/// @brief Gets an index that identifies the value type
+	virtual auto valueTypeIndex() const -> std::size_t = 0;
+
+	/// @brief Adds the read state to the read batch for the value type of a read operation
+	/// @param operation The read operation that reads the value. The read state of the operation will also be used for the
+	/// inherited read state attributes.
+	/// @param address The address of the value in the I/O component
+	virtual auto addToReadOperation(ReadOperation &operation, const DataAddress &address) -> void = 0;
 		
 	/// @brief Attaches the write state to an I/O transaction
 	/// @param dataArray The data array that the attributes should be added to. The caller will use the information in this array
@@ -109,12 +113,15 @@ public:
 	/// @param eventCount A variable that counts the total number of events than can be raised for a single update.
 	/// The maximum number of events that update() will request to be raised will be added to this variable. The caller will use this
 	/// event count to preallocate a buffer when collecting the events to raise after an update.
-	virtual auto attachWriteState(memory::Array &dataArray, std::size_t &eventCount) -> void = 0;
+	/// @param pendingMarker The marker the output must use to signal that a value is pending. The I/O transaction
+	/// only checks outputs for pending values if they have been marked.
+	virtual auto attachWriteState(memory::Array &dataArray, std::size_t &eventCount, PendingOutputSet::Marker pendingMarker) -> void = 0;
 
 	/// @brief Adds any pending output value to a write command.
 	/// @param command The write command to add the value to.
+	/// @param address The address of the value
 	/// @return This function must return *true* if data was added, or *false* if no value was pending.
-	virtual auto addToWriteCommand(WriteCommand &command) -> bool = 0;
+	virtual auto addToWriteCommand(WriteCommand &command, const DataAddress &address) -> bool = 0;
 
 	/// @brief Updates the write state and collects the events to send
 	/// @param writeSentinel A write sentinel for the data block the data is stored in
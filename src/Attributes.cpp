@@ -2,12 +2,156 @@
 #include "Attributes.hpp"
 
 #include <xentara/data/DataType.hpp>
+#include <xentara/utils/core/Uuid.hpp>
+
+#include <string_view>
 
 namespace xentara::plugins::templateDriver::attributes
 {
 
+using namespace std::literals;
+using namespace xentara::literals;
+
 const model::Attribute kError { model::Attribute::kError, model::Attribute::Access::ReadOnly, data::DataType::kErrorCode };
 
 const model::Attribute kWriteError { model::Attribute::kWriteError, model::Attribute::Access::ReadOnly, data::DataType::kErrorCode };
 
-} // namespace xentara::plugins::templateDriver::attributes
+/// @todo assign a unique UUID
+const model::Attribute kReadCommandCount { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readCommands"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kUnusedReadBytes { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "unusedReadBytes"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kControlQueueWaitTime { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "controlQueueWaitTime"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kNormalQueueWaitTime { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "normalQueueWaitTime"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kBulkQueueWaitTime { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "bulkQueueWaitTime"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kIoThreadCpuTime { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "ioThreadCpuTime"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kDecodeThreadCpuTime { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "decodeThreadCpuTime"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kReadDurationP50 { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readDurationP50"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kReadDurationP99 { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readDurationP99"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kReadDurationP999 { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readDurationP999"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kReadDurationMax { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readDurationMax"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kWriteDurationP50 { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writeDurationP50"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kWriteDurationP99 { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writeDurationP99"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kWriteDurationP999 { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writeDurationP999"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kWriteDurationMax { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writeDurationMax"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kStartLagP50 { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "startLagP50"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kStartLagP99 { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "startLagP99"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kStartLagP999 { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "startLagP999"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kStartLagMax { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "startLagMax"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kReadSubmitTimeMean { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readSubmitTimeMean"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kReadSubmitTimeMax { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readSubmitTimeMax"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kReadWaitTimeMean { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readWaitTimeMean"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kReadWaitTimeMax { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readWaitTimeMax"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kDecodeTimeMean { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "decodeTimeMean"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kDecodeTimeMax { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "decodeTimeMax"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kValueUpdateTimeMean { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "valueUpdateTimeMean"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kValueUpdateTimeMax { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "valueUpdateTimeMax"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kCommitTimeMean { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "commitTimeMean"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kCommitTimeMax { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "commitTimeMax"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kReadCount { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readCount"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kWriteCount { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writeCount"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kFailedReadCount { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "failedReadCount"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kFailedWriteCount { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "failedWriteCount"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kBytesSent { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "bytesSent"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kBytesReceived { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "bytesReceived"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kReadCommandsIssued { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readCommandsIssued"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kRetryCount { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "retryCount"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kTimeoutCount { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "timeoutCount"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kChangedInputCount { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "changedInputCount"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kReadOverrunCount { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readOverruns"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kConsecutiveReadOverruns { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "consecutiveReadOverruns"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kWriteOverrunCount { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writeOverruns"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kConsecutiveWriteOverruns { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "consecutiveWriteOverruns"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kExchangeOverrunCount { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "exchangeOverruns"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kConsecutiveExchangeOverruns { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "consecutiveExchangeOverruns"sv, model::Attribute::Access::ReadOnly, data::DataType::kInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kResetTimingStatistics { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "resetTimingStatistics"sv, model::Attribute::Access::WriteOnly, data::DataType::kBoolean };
+
+} // namespace xentara::plugins::templateDriver::attributes
\ No newline at end of file
@@ -12,4 +12,106 @@ extern const model::Attribute kError;
 /// @brief A Xentara attribute containing a write error code for a data point
 extern const model::Attribute kWriteError;
 
+/// @brief A Xentara attribute containing the number of commands a transaction uses to read its inputs
+extern const model::Attribute kReadCommandCount;
+/// @brief A Xentara attribute containing the number of bytes a transaction reads that do not belong to any input
+extern const model::Attribute kUnusedReadBytes;
+
+/// @brief A Xentara attribute containing the average time control requests wait in the queue of an I/O component, in seconds
+extern const model::Attribute kControlQueueWaitTime;
+/// @brief A Xentara attribute containing the average time normal requests wait in the queue of an I/O component, in seconds
+extern const model::Attribute kNormalQueueWaitTime;
+/// @brief A Xentara attribute containing the average time bulk requests wait in the queue of an I/O component, in seconds
+extern const model::Attribute kBulkQueueWaitTime;
+
+/// @brief A Xentara attribute containing the CPU time used by the I/O worker thread of an I/O component, in seconds
+extern const model::Attribute kIoThreadCpuTime;
+/// @brief A Xentara attribute containing the total CPU time used by the decode threads of the driver, in seconds
+extern const model::Attribute kDecodeThreadCpuTime;
+
+/// @brief A Xentara attribute containing the median of the time the read task of a transaction takes, in seconds
+extern const model::Attribute kReadDurationP50;
+/// @brief A Xentara attribute containing the 99th percentile of the time the read task of a transaction takes, in seconds
+extern const model::Attribute kReadDurationP99;
+/// @brief A Xentara attribute containing the 99.9th percentile of the time the read task of a transaction takes, in seconds
+extern const model::Attribute kReadDurationP999;
+/// @brief A Xentara attribute containing the maximum of the time the read task of a transaction takes, in seconds
+extern const model::Attribute kReadDurationMax;
+
+/// @brief A Xentara attribute containing the median of the time a transaction takes to write its outputs, in seconds
+extern const model::Attribute kWriteDurationP50;
+/// @brief A Xentara attribute containing the 99th percentile of the time a transaction takes to write its outputs, in seconds
+extern const model::Attribute kWriteDurationP99;
+/// @brief A Xentara attribute containing the 99.9th percentile of the time a transaction takes to write its outputs, in seconds
+extern const model::Attribute kWriteDurationP999;
+/// @brief A Xentara attribute containing the maximum of the time a transaction takes to write its outputs, in seconds
+extern const model::Attribute kWriteDurationMax;
+
+/// @brief A Xentara attribute containing the median of the time between the scheduled and the actual start of the tasks of a transaction, in seconds
+extern const model::Attribute kStartLagP50;
+/// @brief A Xentara attribute containing the 99th percentile of the time between the scheduled and the actual start of the tasks of a transaction, in seconds
+extern const model::Attribute kStartLagP99;
+/// @brief A Xentara attribute containing the 99.9th percentile of the time between the scheduled and the actual start of the tasks of a transaction, in seconds
+extern const model::Attribute kStartLagP999;
+/// @brief A Xentara attribute containing the maximum of the time between the scheduled and the actual start of the tasks of a transaction, in seconds
+extern const model::Attribute kStartLagMax;
+
+/// @brief A Xentara attribute containing the average time a read of a transaction spends encoding and submitting the read commands, in seconds
+extern const model::Attribute kReadSubmitTimeMean;
+/// @brief A Xentara attribute containing the maximum time a read of a transaction spends encoding and submitting the read commands, in seconds
+extern const model::Attribute kReadSubmitTimeMax;
+/// @brief A Xentara attribute containing the average time a read of a transaction spends waiting for the responses to the read commands, in seconds
+extern const model::Attribute kReadWaitTimeMean;
+/// @brief A Xentara attribute containing the maximum time a read of a transaction spends waiting for the responses to the read commands, in seconds
+extern const model::Attribute kReadWaitTimeMax;
+/// @brief A Xentara attribute containing the average time a read of a transaction spends decoding the values using the vectorized kernels, in seconds
+extern const model::Attribute kDecodeTimeMean;
+/// @brief A Xentara attribute containing the maximum time a read of a transaction spends decoding the values using the vectorized kernels, in seconds
+extern const model::Attribute kDecodeTimeMax;
+/// @brief A Xentara attribute containing the average time a read of a transaction spends updating the read states of the inputs, in seconds
+extern const model::Attribute kValueUpdateTimeMean;
+/// @brief A Xentara attribute containing the maximum time a read of a transaction spends updating the read states of the inputs, in seconds
+extern const model::Attribute kValueUpdateTimeMax;
+/// @brief A Xentara attribute containing the average time a read of a transaction spends committing the data and raising the events, in seconds
+extern const model::Attribute kCommitTimeMean;
+/// @brief A Xentara attribute containing the maximum time a read of a transaction spends committing the data and raising the events, in seconds
+extern const model::Attribute kCommitTimeMax;
+
+/// @brief A Xentara attribute containing the number of reads performed
+extern const model::Attribute kReadCount;
+/// @brief A Xentara attribute containing the number of writes performed
+extern const model::Attribute kWriteCount;
+/// @brief A Xentara attribute containing the number of reads that failed
+extern const model::Attribute kFailedReadCount;
+/// @brief A Xentara attribute containing the number of writes that failed
+extern const model::Attribute kFailedWriteCount;
+/// @brief A Xentara attribute containing the number of bytes sent to the I/O component
+extern const model::Attribute kBytesSent;
+/// @brief A Xentara attribute containing the number of bytes received from the I/O component
+extern const model::Attribute kBytesReceived;
+/// @brief A Xentara attribute containing the number of read commands issued
+extern const model::Attribute kReadCommandsIssued;
+/// @brief A Xentara attribute containing the number of requests that were retried
+extern const model::Attribute kRetryCount;
+/// @brief A Xentara attribute containing the number of reads that timed out
+extern const model::Attribute kTimeoutCount;
+/// @brief A Xentara attribute containing the number of times an input value changed when it was read
+extern const model::Attribute kChangedInputCount;
+
+/// @brief A Xentara attribute containing the number of times the read task of a transaction overran
+extern const model::Attribute kReadOverrunCount;
+/// @brief A Xentara attribute containing the number of consecutive overruns of the read task of a transaction
+extern const model::Attribute kConsecutiveReadOverruns;
+/// @brief A Xentara attribute containing the number of times the write task of a transaction overran
+extern const model::Attribute kWriteOverrunCount;
+/// @brief A Xentara attribute containing the number of consecutive overruns of the write task of a transaction
+extern const model::Attribute kConsecutiveWriteOverruns;
+/// @brief A Xentara attribute containing the number of times the exchange task of a transaction overran
+extern const model::Attribute kExchangeOverrunCount;
+/// @brief A Xentara attribute containing the number of consecutive overruns of the exchange task of a transaction
+extern const model::Attribute kConsecutiveExchangeOverruns;
+
+/// @brief A Xentara attribute that resets the timing statistics of a transaction when *true* is written to it
+extern const model::Attribute kResetTimingStatistics;
+
 } // namespace xentara::plugins::templateDriver::attributes
\ No newline at end of file
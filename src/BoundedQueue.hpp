@@ -0,0 +1,135 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <xentara/utils/tools/Unique.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief A thread-safe, lock-free queue with a fixed capacity.
+///
+/// Any number of threads may push and pop values concurrently. The queue uses a ring of cells that each carry a sequence number,
+/// so that producers and consumers only need a single atomic operation on the shared positions. All memory is allocated
+/// by reset(), so pushing and popping never allocates.
+template <typename Value>
+class BoundedQueue final : private utils::tools::Unique
+{
+public:
+	/// @brief Allocates the ring, and clears the queue. This must not be called while other threads use the queue.
+	/// @param capacity The minimum number of values the queue must be able to hold. The actual capacity is rounded up
+	/// to the next power of two.
+	auto reset(std::size_t capacity) -> void
+	{
+		const auto size = std::bit_ceil(std::max(capacity, std::size_t(2)));
+		_cells = std::make_unique<Cell[]>(size);
+		for (std::size_t index = 0; index < size; ++index)
+		{
+			_cells[index]._sequence.store(index, std::memory_order_relaxed);
+		}
+		_mask = size - 1;
+		_pushPosition.store(0, std::memory_order_relaxed);
+		_popPosition.store(0, std::memory_order_relaxed);
+	}
+
+	/// @brief Appends a value to the queue
+	/// @param value The value to append
+	/// @return Returns true if the value was appended, or false if the queue is full
+	auto tryPush(const Value &value) noexcept -> bool
+	{
+		auto position = _pushPosition.load(std::memory_order_relaxed);
+		while (true)
+		{
+			auto &cell = _cells[position & _mask];
+			const auto sequence = cell._sequence.load(std::memory_order_acquire);
+
+			// If the cell is free for this position, try to claim it
+			if (sequence == position)
+			{
+				if (_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					cell._value = value;
+					// Mark the cell as filled
+					cell._sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			// If the cell still holds the value from the last round, the queue is full
+			else if (sequence < position)
+			{
+				return false;
+			}
+			// Another thread has claimed the cell already, so try again with the current position
+			else
+			{
+				position = _pushPosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/// @brief Removes the first value from the queue
+	/// @return The value, or std::nullopt if the queue is empty
+	auto tryPop() noexcept -> std::optional<Value>
+	{
+		auto position = _popPosition.load(std::memory_order_relaxed);
+		while (true)
+		{
+			auto &cell = _cells[position & _mask];
+			const auto sequence = cell._sequence.load(std::memory_order_acquire);
+
+			// If the cell has been filled for this position, try to claim it
+			if (sequence == position + 1)
+			{
+				if (_popPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					const auto value = cell._value;
+					// Mark the cell as free for the next round
+					cell._sequence.store(position + _mask + 1, std::memory_order_release);
+					return value;
+				}
+			}
+			// If the cell has not been filled yet, the queue is empty
+			else if (sequence < position + 1)
+			{
+				return std::nullopt;
+			}
+			// Another thread has claimed the cell already, so try again with the current position
+			else
+			{
+				position = _popPosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+private:
+	/// @brief A cell of the ring
+	struct Cell
+	{
+		/// @brief The sequence number that tells producers and consumers whether the cell is filled
+		std::atomic<std::size_t> _sequence { 0 };
+		/// @brief The value
+		Value _value {};
+	};
+
+	/// @brief The size of a cache line, used to keep the positions from sharing one
+	static constexpr std::size_t kCacheLineSize = 64;
+
+	/// @brief The cells
+	std::unique_ptr<Cell[]> _cells;
+	/// @brief The mask used to map positions to cells
+	std::size_t _mask { 0 };
+
+	/// @brief The position the next value will be pushed to
+	alignas(kCacheLineSize) std::atomic<std::size_t> _pushPosition { 0 };
+	/// @brief The position the next value will be popped from
+	alignas(kCacheLineSize) std::atomic<std::size_t> _popPosition { 0 };
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,48 @@
+// Copyright (c) embedded ocean GmbH
+#include "ByteOrder.hpp"
+
+#include <xentara/utils/json/decoder/Errors.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace xentara::plugins::templateDriver
+{
+
+using namespace std::literals;
+
+auto loadByteOrder(utils::json::decoder::Value &value) -> ByteOrder
+{
+	// Get the keyword from the value
+	auto keyword = value.asString<std::string>();
+
+	/// @todo use keywords that are appropriate to the I/O component
+	if (keyword == "bigEndian"sv)
+	{
+		return ByteOrder::BigEndian;
+	}
+	else if (keyword == "littleEndian"sv)
+	{
+		return ByteOrder::LittleEndian;
+	}
+	else if (keyword == "bigEndianWordSwapped"sv)
+	{
+		return ByteOrder::BigEndianWordSwapped;
+	}
+	else if (keyword == "littleEndianWordSwapped"sv)
+	{
+		return ByteOrder::LittleEndianWordSwapped;
+	}
+
+	// The keyword is not known
+	else
+	{
+		/// @todo replace "template data point" with a more descriptive name
+		utils::json::decoder::throwWithLocation(value, std::runtime_error("unknown byte order in template data point"));
+	}
+
+	return ByteOrder::BigEndian;
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,115 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <xentara/utils/json/decoder/Value.hpp>
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief The byte order of a value in the data exchanged with the I/O component
+/// @todo add any additional byte orders the I/O component uses
+enum class ByteOrder
+{
+	/// @brief The most significant byte comes first
+	BigEndian,
+	/// @brief The least significant byte comes first
+	LittleEndian,
+	/// @brief The value is made up of big endian 16-bit words, with the least significant word first.
+	///
+	/// This is a common format for 32 and 64 bit values in devices that use 16-bit registers.
+	BigEndianWordSwapped,
+	/// @brief The value is made up of little endian 16-bit words, with the most significant word first.
+	LittleEndianWordSwapped
+};
+
+/// @brief The byte order of the computer the driver is running on
+constexpr auto kNativeByteOrder = std::endian::native == std::endian::big ? ByteOrder::BigEndian : ByteOrder::LittleEndian;
+
+/// @brief Reverses the order of the bytes in an integer
+///
+/// This is the same as std::byteswap(), which is only available from C++23 onwards. Compilers recognize this pattern
+/// and generate a single byte swap instruction for it.
+template <std::unsigned_integral Integer>
+constexpr auto byteSwap(Integer value) noexcept -> Integer
+{
+	Integer result { 0 };
+	for (std::size_t index = 0; index < sizeof(Integer); ++index)
+	{
+		result = Integer(result << 8) | Integer(value & 0xff);
+		value = Integer(value >> 8);
+	}
+	return result;
+}
+
+/// @brief Swaps the two bytes in each 16-bit word of an integer
+template <std::unsigned_integral Integer>
+constexpr auto swapBytesInWords(Integer value) noexcept -> Integer
+{
+	// A single byte has nothing to swap
+	if constexpr (sizeof(Integer) == 1)
+	{
+		return value;
+	}
+	else
+	{
+		// Create a mask with the lower byte of each word set (0x00ff00ff...)
+		constexpr auto kLowBytes = Integer(Integer(~Integer(0)) / Integer(0xffff) * Integer(0x00ff));
+		return Integer(Integer(Integer(value & kLowBytes) << 8) | Integer(Integer(value >> 8) & kLowBytes));
+	}
+}
+
+/// @brief Converts an integer loaded from memory from a specific byte order to native byte order
+/// @param raw The raw integer, as loaded from memory using a native load
+/// @param byteOrder The byte order of the data in memory
+/// @return The value of the integer
+template <std::unsigned_integral Integer>
+constexpr auto toNativeByteOrder(Integer raw, ByteOrder byteOrder) noexcept -> Integer
+{
+	// Check if the byte order matches the native byte order
+	if (byteOrder == kNativeByteOrder)
+	{
+		return raw;
+	}
+
+	// Check for the full reversal
+	if (byteOrder == ByteOrder::BigEndian || byteOrder == ByteOrder::LittleEndian)
+	{
+		return byteSwap(raw);
+	}
+
+	// For word swapped byte orders, either the bytes within the words or the order of the words themselves matches
+	// the native byte order, but not both
+	const auto bytesInWordsHaveNativeOrder = (byteOrder == ByteOrder::BigEndianWordSwapped) == (kNativeByteOrder == ByteOrder::BigEndian);
+	if (bytesInWordsHaveNativeOrder)
+	{
+		// Only the order of the words needs to be reversed
+		return byteSwap(swapBytesInWords(raw));
+	}
+	else
+	{
+		// Only the order of the bytes within the words needs to be reversed
+		return swapBytesInWords(raw);
+	}
+}
+
+/// @brief Converts an integer from native byte order to a specific byte order, so it can be stored using a native store
+/// @param value The value of the integer
+/// @param byteOrder The byte order the data should have in memory
+/// @return The raw integer to store
+template <std::unsigned_integral Integer>
+constexpr auto fromNativeByteOrder(Integer value, ByteOrder byteOrder) noexcept -> Integer
+{
+	// All the conversions only swap bytes, so they are their own inverse
+	return toNativeByteOrder(value, byteOrder);
+}
+
+/// @brief Loads a byte order from a configuration value
+/// @param value The JSON value to load the byte order from
+/// @return The byte order. If the value contains an unknown keyword, an exception is thrown.
+auto loadByteOrder(utils::json::decoder::Value &value) -> ByteOrder;
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -44,6 +44,18 @@ namespace
 		case CustomError::NoData:
 			return "no data was read yet"s;
 
+		case CustomError::IncompleteResponse:
+			return "the response from the I/O component was incomplete"s;
+
+		case CustomError::UnexpectedResponse:
+			return "the I/O component sent an unexpected response"s;
+
+		case CustomError::IoQueueFull:
+			return "too many requests were queued for the I/O component"s;
+
+		case CustomError::Timeout:
+			return "the I/O component did not respond before the deadline"s;
+
 		/// @todo Add messages for other error codes
 
 		case CustomError::UnknownError:
@@ -17,6 +17,18 @@ enum class CustomError
 	/// @brief No data has been read yet.
 	NoData,
 
+	/// @brief The response from the I/O component did not contain all the requested data.
+	IncompleteResponse,
+
+	/// @brief A response from the I/O component did not belong to the request that was sent.
+	UnexpectedResponse,
+
+	/// @brief The queue of the I/O worker of the I/O component was full.
+	IoQueueFull,
+
+	/// @brief The I/O component did not respond before the deadline.
+	Timeout,
+
 	/// @brief An unknown error occurred
 	UnknownError = 999
 };
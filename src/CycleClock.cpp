@@ -0,0 +1,39 @@
+// Copyright (c) embedded ocean GmbH
+#include "CycleClock.hpp"
+
+namespace xentara::plugins::templateDriver
+{
+
+namespace
+{
+
+/// @brief Measures the duration of a tick of the cycle clock
+auto calibrate() noexcept -> double
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	// Compare the time stamp counter with the steady clock over a short interval
+	const auto steadyStart = std::chrono::steady_clock::now();
+	const auto ticksStart = CycleClock::now();
+	auto steadyEnd = steadyStart;
+	while (steadyEnd - steadyStart < std::chrono::milliseconds(2))
+	{
+		steadyEnd = std::chrono::steady_clock::now();
+	}
+	const auto ticks = CycleClock::now() - ticksStart;
+
+	return std::chrono::duration<double>(steadyEnd - steadyStart).count() / double(ticks);
+#else
+	// The steady clock is used directly, which counts nanoseconds
+	return 1e-9;
+#endif
+}
+
+} // namespace
+
+auto CycleClock::secondsPerTick() noexcept -> double
+{
+	static const auto kSecondsPerTick = calibrate();
+	return kSecondsPerTick;
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
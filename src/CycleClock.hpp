@@ -0,0 +1,47 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#	include <x86intrin.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#	include <intrin.h>
+#endif
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief A clock for timing short sections of code with very little overhead
+///
+/// On x86 processors, the clock reads the time stamp counter, which takes only a few nanoseconds. The counter runs at a
+/// constant rate on all current x86 processors, and is converted to seconds using a rate that is measured once. On other
+/// processors, the steady clock is used instead.
+class CycleClock final
+{
+public:
+	/// @brief Gets the current value of the clock, in ticks
+	static auto now() noexcept -> std::uint64_t
+	{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+		return __rdtsc();
+#else
+		return std::uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+	}
+
+	/// @brief Converts a number of ticks to seconds
+	static auto toSeconds(std::uint64_t ticks) noexcept -> double
+	{
+		return double(ticks) * secondsPerTick();
+	}
+
+	/// @brief Gets the duration of a tick, in seconds
+	///
+	/// The first call measures the rate of the clock, which takes a few milliseconds. This function should therefore be called
+	/// once before the clock is used in time critical code.
+	static auto secondsPerTick() noexcept -> double;
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
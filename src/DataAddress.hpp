@@ -0,0 +1,27 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "ByteOrder.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief The location and encoding of the value of a data point within the I/O component
+/// @todo adapt this to the addressing scheme of the I/O component
+struct DataAddress final
+{
+	/// @brief The address of the first byte of the value
+	/// @todo If the I/O component does not use byte addresses, but e.g. 16-bit register numbers, the transaction must
+	/// convert the addresses to byte offsets when computing the decode descriptors.
+	std::uint64_t _address { 0 };
+	/// @brief The number of bytes the value occupies
+	std::size_t _size { 0 };
+	/// @brief The byte order of the value
+	/// @todo use the default byte order of the I/O component
+	ByteOrder _byteOrder { ByteOrder::BigEndian };
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,600 @@
+// Copyright (c) embedded ocean GmbH
+#include "DecodeKernels.hpp"
+
+#include "ValueCodec.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#	define TEMPLATE_DRIVER_X86 1
+#	include <immintrin.h>
+#	if defined(_MSC_VER)
+#		include <intrin.h>
+#	endif
+#endif
+
+// GCC and Clang need to be told which instruction set a function may use. MSVC allows all intrinsics everywhere.
+#if defined(__GNUC__)
+#	define TEMPLATE_DRIVER_TARGET(targetName) __attribute__((target(targetName)))
+#else
+#	define TEMPLATE_DRIVER_TARGET(targetName)
+#endif
+
+namespace xentara::plugins::templateDriver::kernels
+{
+
+namespace
+{
+
+	/// @brief Detects the best instruction set supported by the processor
+	auto detectInstructionSet() noexcept -> InstructionSet
+	{
+#if defined(TEMPLATE_DRIVER_X86) && defined(__GNUC__)
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+		{
+			return InstructionSet::Avx2;
+		}
+		if (__builtin_cpu_supports("sse4.1"))
+		{
+			return InstructionSet::Sse41;
+		}
+#elif defined(TEMPLATE_DRIVER_X86) && defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 1);
+		const bool hasSse41 = (info[2] & (1 << 19)) != 0;
+		const bool hasOsXSave = (info[2] & (1 << 27)) != 0;
+		const bool hasAvx = (info[2] & (1 << 28)) != 0;
+		// AVX2 can only be used if the operating system saves the YMM registers on context switches
+		if (hasOsXSave && hasAvx && (_xgetbv(0) & 0x6) == 0x6)
+		{
+			__cpuidex(info, 7, 0);
+			if ((info[1] & (1 << 5)) != 0)
+			{
+				return InstructionSet::Avx2;
+			}
+		}
+		if (hasSse41)
+		{
+			return InstructionSet::Sse41;
+		}
+#endif
+		return InstructionSet::Scalar;
+	}
+
+	/// @brief Gets the position of a byte of a specific significance within a value in memory
+	/// @param significance The significance of the byte, with 0 being the least significant byte
+	/// @param elementSize The size of the value
+	/// @param byteOrder The byte order of the value
+	constexpr auto bytePosition(std::size_t significance, std::size_t elementSize, ByteOrder byteOrder) noexcept -> std::size_t
+	{
+		// Single bytes and 16-bit words are not affected by word swapping
+		if (elementSize <= 2 && byteOrder == ByteOrder::BigEndianWordSwapped)
+		{
+			byteOrder = ByteOrder::BigEndian;
+		}
+		else if (elementSize <= 2 && byteOrder == ByteOrder::LittleEndianWordSwapped)
+		{
+			byteOrder = ByteOrder::LittleEndian;
+		}
+
+		const auto word = significance / 2;
+		const auto byteInWord = significance % 2;
+
+		switch (byteOrder)
+		{
+		case ByteOrder::BigEndian:
+			return elementSize - 1 - significance;
+		case ByteOrder::LittleEndian:
+		default:
+			return significance;
+		case ByteOrder::BigEndianWordSwapped:
+			return word * 2 + (1 - byteInWord);
+		case ByteOrder::LittleEndianWordSwapped:
+			return (elementSize / 2 - 1 - word) * 2 + byteInWord;
+		}
+	}
+
+	/// @brief Converts a run of values to native byte order using scalar code
+	template <std::unsigned_integral Raw>
+	auto toNativeByteOrderScalar(const std::byte *source, std::byte *destination, std::size_t count, ByteOrder byteOrder) -> void
+	{
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			// memcpy() is used because the data need not be aligned correctly. This compiles to a single load/store instruction.
+			Raw raw;
+			std::memcpy(&raw, source + index * sizeof(Raw), sizeof(Raw));
+			raw = templateDriver::toNativeByteOrder(raw, byteOrder);
+			std::memcpy(destination + index * sizeof(Raw), &raw, sizeof(Raw));
+		}
+	}
+
+	/// @brief Converts a run of values to native byte order using scalar code
+	auto toNativeByteOrderScalar(const std::byte *source, std::byte *destination, std::size_t count, const ByteShuffle &shuffle) -> void
+	{
+		switch (shuffle.elementSize())
+		{
+		case 2:
+			toNativeByteOrderScalar<std::uint16_t>(source, destination, count, shuffle.byteOrder());
+			break;
+		case 4:
+			toNativeByteOrderScalar<std::uint32_t>(source, destination, count, shuffle.byteOrder());
+			break;
+		case 8:
+			toNativeByteOrderScalar<std::uint64_t>(source, destination, count, shuffle.byteOrder());
+			break;
+		default:
+			std::memcpy(destination, source, count * shuffle.elementSize());
+			break;
+		}
+	}
+
+	/// @brief Widens a run of integers using scalar code
+	template <typename Target>
+	auto widenScalar(const std::byte *source, std::size_t sourceSize, Target *destination, std::size_t count) -> void
+	{
+		// Widens integers of a specific size
+		auto widenFrom = [&]<std::size_t kSourceSize>(std::integral_constant<std::size_t, kSourceSize>)
+		{
+			// The source has the same signedness as the target
+			using Unsigned = typename detail::UnsignedOfSize<kSourceSize>::type;
+			using Source = std::conditional_t<std::is_signed_v<Target>, std::make_signed_t<Unsigned>, Unsigned>;
+
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				Source value;
+				std::memcpy(&value, source + index * kSourceSize, kSourceSize);
+				destination[index] = Target(value);
+			}
+		};
+
+		switch (sourceSize)
+		{
+		case 1:
+			widenFrom(std::integral_constant<std::size_t, 1> {});
+			break;
+		case 2:
+			widenFrom(std::integral_constant<std::size_t, 2> {});
+			break;
+		case 4:
+			widenFrom(std::integral_constant<std::size_t, 4> {});
+			break;
+		default:
+			throw std::logic_error("internal error: unsupported source size for integer widening");
+		}
+	}
+
+#if defined(TEMPLATE_DRIVER_X86)
+
+	/// @brief Converts a run of values to native byte order using SSSE3 byte shuffles
+	TEMPLATE_DRIVER_TARGET("sse4.1")
+	auto toNativeByteOrderSse41(const std::byte *source, std::byte *destination, std::size_t count, const ByteShuffle &shuffle) -> void
+	{
+		const auto mask = _mm_loadu_si128(reinterpret_cast<const __m128i *>(shuffle.mask().data()));
+
+		// Convert 16 bytes at a time
+		const auto size = count * shuffle.elementSize();
+		std::size_t offset = 0;
+		for (; offset + 16 <= size; offset += 16)
+		{
+			const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + offset));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(destination + offset), _mm_shuffle_epi8(block, mask));
+		}
+
+		// Convert the remaining values using scalar code
+		toNativeByteOrderScalar(source + offset, destination + offset, (size - offset) / shuffle.elementSize(), shuffle);
+	}
+
+	/// @brief Converts a run of values to native byte order using AVX2 byte shuffles
+	TEMPLATE_DRIVER_TARGET("avx2")
+	auto toNativeByteOrderAvx2(const std::byte *source, std::byte *destination, std::size_t count, const ByteShuffle &shuffle) -> void
+	{
+		// The AVX2 shuffle operates on the two 128-bit lanes separately, so the same mask is used for both lanes
+		const auto mask = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(shuffle.mask().data())));
+
+		// Convert 32 bytes at a time
+		const auto size = count * shuffle.elementSize();
+		std::size_t offset = 0;
+		for (; offset + 32 <= size; offset += 32)
+		{
+			const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + offset));
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + offset), _mm256_shuffle_epi8(block, mask));
+		}
+
+		// Convert the remaining values using scalar code
+		toNativeByteOrderScalar(source + offset, destination + offset, (size - offset) / shuffle.elementSize(), shuffle);
+	}
+
+	/// @brief Sign or zero extends the integers in the lower 64 bits of an SSE register to twice their size
+	template <typename Target>
+	TEMPLATE_DRIVER_TARGET("sse4.1")
+	auto extendSse41(__m128i source) -> __m128i
+	{
+		if constexpr (std::same_as<Target, std::int16_t>)
+		{
+			return _mm_cvtepi8_epi16(source);
+		}
+		else if constexpr (std::same_as<Target, std::uint16_t>)
+		{
+			return _mm_cvtepu8_epi16(source);
+		}
+		else if constexpr (std::same_as<Target, std::int32_t>)
+		{
+			return _mm_cvtepi16_epi32(source);
+		}
+		else if constexpr (std::same_as<Target, std::uint32_t>)
+		{
+			return _mm_cvtepu16_epi32(source);
+		}
+		else if constexpr (std::same_as<Target, std::int64_t>)
+		{
+			return _mm_cvtepi32_epi64(source);
+		}
+		else
+		{
+			static_assert(std::same_as<Target, std::uint64_t>);
+			return _mm_cvtepu32_epi64(source);
+		}
+	}
+
+	/// @brief Sign or zero extends the integers in an SSE register to twice their size in an AVX register
+	template <typename Target>
+	TEMPLATE_DRIVER_TARGET("avx2")
+	auto extendAvx2(__m128i source) -> __m256i
+	{
+		if constexpr (std::same_as<Target, std::int16_t>)
+		{
+			return _mm256_cvtepi8_epi16(source);
+		}
+		else if constexpr (std::same_as<Target, std::uint16_t>)
+		{
+			return _mm256_cvtepu8_epi16(source);
+		}
+		else if constexpr (std::same_as<Target, std::int32_t>)
+		{
+			return _mm256_cvtepi16_epi32(source);
+		}
+		else if constexpr (std::same_as<Target, std::uint32_t>)
+		{
+			return _mm256_cvtepu16_epi32(source);
+		}
+		else if constexpr (std::same_as<Target, std::int64_t>)
+		{
+			return _mm256_cvtepi32_epi64(source);
+		}
+		else
+		{
+			static_assert(std::same_as<Target, std::uint64_t>);
+			return _mm256_cvtepu32_epi64(source);
+		}
+	}
+
+	/// @brief Widens a run of integers to twice their size using SSE4.1
+	template <typename Target>
+	TEMPLATE_DRIVER_TARGET("sse4.1")
+	auto widenSse41(const std::byte *source, Target *destination, std::size_t count) -> void
+	{
+		constexpr auto kSourceSize = sizeof(Target) / 2;
+		// Each step produces 16 bytes of output
+		constexpr auto kStep = 16 / sizeof(Target);
+
+		std::size_t index = 0;
+		for (; index + kStep <= count; index += kStep)
+		{
+			const auto block = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(source + index * kSourceSize));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(destination + index), extendSse41<Target>(block));
+		}
+
+		// Widen the remaining values using scalar code
+		widenScalar(source + index * kSourceSize, kSourceSize, destination + index, count - index);
+	}
+
+	/// @brief Widens a run of integers to twice their size using AVX2
+	template <typename Target>
+	TEMPLATE_DRIVER_TARGET("avx2")
+	auto widenAvx2(const std::byte *source, Target *destination, std::size_t count) -> void
+	{
+		constexpr auto kSourceSize = sizeof(Target) / 2;
+		// Each step produces 32 bytes of output
+		constexpr auto kStep = 32 / sizeof(Target);
+
+		std::size_t index = 0;
+		for (; index + kStep <= count; index += kStep)
+		{
+			const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + index * kSourceSize));
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + index), extendAvx2<Target>(block));
+		}
+
+		// Widen the remaining values using scalar code
+		widenScalar(source + index * kSourceSize, kSourceSize, destination + index, count - index);
+	}
+
+#endif // defined(TEMPLATE_DRIVER_X86)
+
+	/// @brief Finds changed values using scalar code
+	template <typename Value>
+	auto findChangesScalar(const Value *newValues, const Value *oldValues, std::size_t begin, std::size_t count, std::uint64_t *changes)
+		-> void
+	{
+		for (std::size_t index = begin; index < count; ++index)
+		{
+			changes[index / 64] |= std::uint64_t(newValues[index] != oldValues[index]) << (index % 64);
+		}
+	}
+
+#if defined(TEMPLATE_DRIVER_X86)
+
+	/// @brief Compares a 16 byte block of values, and returns a bit mask of the values that differ
+	template <typename Value>
+	TEMPLATE_DRIVER_TARGET("sse4.1")
+	auto changeBitsSse41(const Value *newValues, const Value *oldValues) -> std::uint64_t
+	{
+		if constexpr (std::same_as<Value, float>)
+		{
+			// _mm_cmpneq_ps() is true for unordered values, just like the != operator
+			return std::uint64_t(_mm_movemask_ps(_mm_cmpneq_ps(_mm_loadu_ps(newValues), _mm_loadu_ps(oldValues))));
+		}
+		else if constexpr (std::same_as<Value, double>)
+		{
+			return std::uint64_t(_mm_movemask_pd(_mm_cmpneq_pd(_mm_loadu_pd(newValues), _mm_loadu_pd(oldValues))));
+		}
+		else
+		{
+			const auto newBlock = _mm_loadu_si128(reinterpret_cast<const __m128i *>(newValues));
+			const auto oldBlock = _mm_loadu_si128(reinterpret_cast<const __m128i *>(oldValues));
+
+			// Compare the values for equality, and collect one bit per value
+			std::uint64_t equal;
+			if constexpr (sizeof(Value) == 1)
+			{
+				equal = std::uint64_t(unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(newBlock, oldBlock))));
+			}
+			else if constexpr (sizeof(Value) == 2)
+			{
+				// Pack the 16-bit results into bytes, so that there is one mask bit per value
+				const auto result = _mm_cmpeq_epi16(newBlock, oldBlock);
+				equal = std::uint64_t(unsigned(_mm_movemask_epi8(_mm_packs_epi16(result, result)))) & 0xff;
+			}
+			else if constexpr (sizeof(Value) == 4)
+			{
+				equal = std::uint64_t(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(newBlock, oldBlock))));
+			}
+			else
+			{
+				equal = std::uint64_t(_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(newBlock, oldBlock))));
+			}
+
+			constexpr std::uint64_t kAllValues = (std::uint64_t(1) << (16 / sizeof(Value))) - 1;
+			return ~equal & kAllValues;
+		}
+	}
+
+	/// @brief Compares a 32 byte block of values, and returns a bit mask of the values that differ
+	template <typename Value>
+	TEMPLATE_DRIVER_TARGET("avx2")
+	auto changeBitsAvx2(const Value *newValues, const Value *oldValues) -> std::uint64_t
+	{
+		if constexpr (std::same_as<Value, float>)
+		{
+			// _CMP_NEQ_UQ is true for unordered values, just like the != operator
+			return std::uint64_t(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(newValues), _mm256_loadu_ps(oldValues), _CMP_NEQ_UQ)));
+		}
+		else if constexpr (std::same_as<Value, double>)
+		{
+			return std::uint64_t(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(newValues), _mm256_loadu_pd(oldValues), _CMP_NEQ_UQ)));
+		}
+		else
+		{
+			const auto newBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(newValues));
+			const auto oldBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(oldValues));
+
+			// Compare the values for equality, and collect one bit per value
+			std::uint64_t equal;
+			if constexpr (sizeof(Value) == 1)
+			{
+				equal = std::uint64_t(unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi8(newBlock, oldBlock))));
+			}
+			else if constexpr (sizeof(Value) == 2)
+			{
+				// Pack the 16-bit results of the two lanes into bytes, so that there is one mask bit per value
+				const auto result = _mm256_cmpeq_epi16(newBlock, oldBlock);
+				const auto packed = _mm_packs_epi16(_mm256_castsi256_si128(result), _mm256_extracti128_si256(result, 1));
+				equal = std::uint64_t(unsigned(_mm_movemask_epi8(packed)));
+			}
+			else if constexpr (sizeof(Value) == 4)
+			{
+				equal = std::uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(newBlock, oldBlock))));
+			}
+			else
+			{
+				equal = std::uint64_t(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(newBlock, oldBlock))));
+			}
+
+			constexpr std::uint64_t kAllValues = (std::uint64_t(1) << (32 / sizeof(Value))) - 1;
+			return ~equal & kAllValues;
+		}
+	}
+
+	/// @brief Finds changed values using SSE4.1
+	template <typename Value>
+	TEMPLATE_DRIVER_TARGET("sse4.1")
+	auto findChangesSse41(const Value *newValues, const Value *oldValues, std::size_t count, std::uint64_t *changes) -> void
+	{
+		// Each step compares 16 bytes. The number of values per step always divides 64, so the bits never straddle two words.
+		constexpr auto kStep = 16 / sizeof(Value);
+
+		std::size_t index = 0;
+		for (; index + kStep <= count; index += kStep)
+		{
+			changes[index / 64] |= changeBitsSse41(newValues + index, oldValues + index) << (index % 64);
+		}
+
+		// Compare the remaining values using scalar code
+		findChangesScalar(newValues, oldValues, index, count, changes);
+	}
+
+	/// @brief Finds changed values using AVX2
+	template <typename Value>
+	TEMPLATE_DRIVER_TARGET("avx2")
+	auto findChangesAvx2(const Value *newValues, const Value *oldValues, std::size_t count, std::uint64_t *changes) -> void
+	{
+		// Each step compares 32 bytes. The number of values per step always divides 64, so the bits never straddle two words.
+		constexpr auto kStep = 32 / sizeof(Value);
+
+		std::size_t index = 0;
+		for (; index + kStep <= count; index += kStep)
+		{
+			changes[index / 64] |= changeBitsAvx2(newValues + index, oldValues + index) << (index % 64);
+		}
+
+		// Compare the remaining values using scalar code
+		findChangesScalar(newValues, oldValues, index, count, changes);
+	}
+
+#endif // defined(TEMPLATE_DRIVER_X86)
+
+	/// @brief Gets the best instruction set supported by the processor. This is detected the first time it is called.
+	auto supportedInstructionSet() noexcept -> InstructionSet
+	{
+		static const auto kInstructionSet = detectInstructionSet();
+		return kInstructionSet;
+	}
+
+	/// @brief Gets the instruction set the kernels use, which defaults to the best one supported
+	auto selectedInstructionSet() noexcept -> std::atomic<InstructionSet> &
+	{
+		static std::atomic<InstructionSet> instructionSet { supportedInstructionSet() };
+		return instructionSet;
+	}
+
+} // namespace
+
+auto instructionSet() noexcept -> InstructionSet
+{
+	return selectedInstructionSet().load(std::memory_order_relaxed);
+}
+
+auto selectInstructionSet(InstructionSet instructionSet) noexcept -> InstructionSet
+{
+	// The instruction sets are ordered by capability, so the supported one is the lesser of the two
+	const auto selected = std::min(instructionSet, supportedInstructionSet());
+	selectedInstructionSet().store(selected, std::memory_order_relaxed);
+	return selected;
+}
+
+ByteShuffle::ByteShuffle(std::size_t elementSize, ByteOrder byteOrder) : _elementSize(elementSize), _byteOrder(byteOrder)
+{
+	// Make sure the element size is supported
+	if (elementSize != 1 && elementSize != 2 && elementSize != 4 && elementSize != 8) [[unlikely]]
+	{
+		throw std::logic_error("internal error: unsupported element size for byte order conversion");
+	}
+
+	// Build the mask for each value in the 16 byte block
+	for (std::size_t elementOffset = 0; elementOffset < _mask.size(); elementOffset += elementSize)
+	{
+		for (std::size_t significance = 0; significance < elementSize; ++significance)
+		{
+			const auto nativePosition = bytePosition(significance, elementSize, kNativeByteOrder);
+			const auto sourcePosition = bytePosition(significance, elementSize, byteOrder);
+
+			_mask[elementOffset + nativePosition] = std::uint8_t(elementOffset + sourcePosition);
+			_isIdentity = _isIdentity && nativePosition == sourcePosition;
+		}
+	}
+}
+
+auto toNativeByteOrder(std::span<const std::byte> source, std::byte *destination, const ByteShuffle &shuffle) -> void
+{
+	// Values that are already in native byte order can just be copied
+	if (shuffle.isIdentity())
+	{
+		std::memcpy(destination, source.data(), source.size());
+		return;
+	}
+
+	const auto count = source.size() / shuffle.elementSize();
+	switch (instructionSet())
+	{
+#if defined(TEMPLATE_DRIVER_X86)
+	case InstructionSet::Avx2:
+		toNativeByteOrderAvx2(source.data(), destination, count, shuffle);
+		break;
+	case InstructionSet::Sse41:
+		toNativeByteOrderSse41(source.data(), destination, count, shuffle);
+		break;
+#endif
+	default:
+		toNativeByteOrderScalar(source.data(), destination, count, shuffle);
+		break;
+	}
+}
+
+template <utils::tools::Integral Target>
+auto widen(const std::byte *source, std::size_t sourceSize, Target *destination, std::size_t count) -> void
+{
+#if defined(TEMPLATE_DRIVER_X86)
+	// The vector instructions only widen integers to twice their size
+	if (sourceSize * 2 == sizeof(Target))
+	{
+		switch (instructionSet())
+		{
+		case InstructionSet::Avx2:
+			widenAvx2(source, destination, count);
+			return;
+		case InstructionSet::Sse41:
+			widenSse41(source, destination, count);
+			return;
+		default:
+			break;
+		}
+	}
+#endif
+
+	widenScalar(source, sourceSize, destination, count);
+}
+
+/// @todo change list of template instantiations to the supported integer types
+template auto widen(const std::byte *source, std::size_t sourceSize, std::uint16_t *destination, std::size_t count) -> void;
+template auto widen(const std::byte *source, std::size_t sourceSize, std::uint32_t *destination, std::size_t count) -> void;
+template auto widen(const std::byte *source, std::size_t sourceSize, std::uint64_t *destination, std::size_t count) -> void;
+template auto widen(const std::byte *source, std::size_t sourceSize, std::int16_t *destination, std::size_t count) -> void;
+template auto widen(const std::byte *source, std::size_t sourceSize, std::int32_t *destination, std::size_t count) -> void;
+template auto widen(const std::byte *source, std::size_t sourceSize, std::int64_t *destination, std::size_t count) -> void;
+
+template <typename Value>
+auto findChanges(const Value *newValues, const Value *oldValues, std::size_t count, std::uint64_t *changes) -> void
+{
+	switch (instructionSet())
+	{
+#if defined(TEMPLATE_DRIVER_X86)
+	case InstructionSet::Avx2:
+		findChangesAvx2(newValues, oldValues, count, changes);
+		break;
+	case InstructionSet::Sse41:
+		findChangesSse41(newValues, oldValues, count, changes);
+		break;
+#endif
+	default:
+		findChangesScalar(newValues, oldValues, 0, count, changes);
+		break;
+	}
+}
+
+/// @todo change list of template instantiations to the supported integer and floating point types
+template auto findChanges(const std::uint8_t *newValues, const std::uint8_t *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+template auto findChanges(const std::uint16_t *newValues, const std::uint16_t *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+template auto findChanges(const std::uint32_t *newValues, const std::uint32_t *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+template auto findChanges(const std::uint64_t *newValues, const std::uint64_t *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+template auto findChanges(const std::int8_t *newValues, const std::int8_t *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+template auto findChanges(const std::int16_t *newValues, const std::int16_t *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+template auto findChanges(const std::int32_t *newValues, const std::int32_t *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+template auto findChanges(const std::int64_t *newValues, const std::int64_t *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+template auto findChanges(const float *newValues, const float *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+template auto findChanges(const double *newValues, const double *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+
+} // namespace xentara::plugins::templateDriver::kernels
\ No newline at end of file
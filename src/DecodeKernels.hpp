@@ -0,0 +1,136 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "ByteOrder.hpp"
+
+#include <xentara/utils/tools/Concepts.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+/// @brief Contains vectorized kernels used to decode and process runs of adjacent values received from the I/O component
+namespace xentara::plugins::templateDriver::kernels
+{
+
+/// @brief The instruction sets the kernels can use
+enum class InstructionSet
+{
+	/// @brief Portable scalar code
+	Scalar,
+	/// @brief SSE4.1 (including SSSE3) instructions
+	Sse41,
+	/// @brief AVX2 instructions
+	Avx2
+};
+
+/// @brief Gets the instruction set the kernels use on this processor
+///
+/// The kernels use SSE4.1 or AVX2 instructions if the processor supports them, and portable scalar code otherwise.
+/// The instruction set is detected once, the first time this function is called.
+auto instructionSet() noexcept -> InstructionSet;
+
+/// @brief Restricts the kernels to a specific instruction set
+///
+/// This is used by the benchmarks to compare the different implementations of the kernels. An instruction set the
+/// processor does not support cannot be selected; the best supported one is used instead.
+/// @param instructionSet The instruction set to use
+/// @return The instruction set the kernels use from now on
+auto selectInstructionSet(InstructionSet instructionSet) noexcept -> InstructionSet;
+
+/// @brief Describes how to convert values of a specific size and byte order to native byte order
+class ByteShuffle final
+{
+public:
+	/// @brief Constructor
+	/// @param elementSize The size of the individual values. Must be 1, 2, 4, or 8.
+	/// @param byteOrder The byte order of the values
+	ByteShuffle(std::size_t elementSize, ByteOrder byteOrder);
+
+	/// @brief Gets the size of the individual values
+	auto elementSize() const noexcept -> std::size_t
+	{
+		return _elementSize;
+	}
+
+	/// @brief Gets the byte order of the values
+	auto byteOrder() const noexcept -> ByteOrder
+	{
+		return _byteOrder;
+	}
+
+	/// @brief Checks whether the values are already in native byte order
+	auto isIdentity() const noexcept -> bool
+	{
+		return _isIdentity;
+	}
+
+	/// @brief Gets the byte permutation for a 16 byte block of values
+	///
+	/// Byte *i* of the converted block is taken from byte *mask[i]* of the source block.
+	auto mask() const noexcept -> const std::array<std::uint8_t, 16> &
+	{
+		return _mask;
+	}
+
+private:
+	/// @brief The size of the individual values
+	std::size_t _elementSize;
+	/// @brief The byte order of the values
+	ByteOrder _byteOrder;
+	/// @brief Whether the values are already in native byte order
+	bool _isIdentity { true };
+	/// @brief The byte permutation for a 16 byte block of values
+	std::array<std::uint8_t, 16> _mask {};
+};
+
+/// @brief Converts a run of adjacent values to native byte order
+/// @param source The raw data of the values. The size must be a multiple of the element size of the shuffle.
+/// @param destination Where to write the converted values. The destination must have room for the same number of
+/// bytes as the source, and must not overlap it. The destination need not be aligned.
+/// @param shuffle The shuffle describing the values
+auto toNativeByteOrder(std::span<const std::byte> source, std::byte *destination, const ByteShuffle &shuffle) -> void;
+
+/// @brief Widens a run of integers in native byte order to a larger integer type
+///
+/// The integers are sign extended if the target type is signed, and zero extended otherwise.
+/// @param source The integers to widen, in native byte order. The source need not be aligned.
+/// @param sourceSize The size of the source integers. Must be 1, 2, or 4, and less than the size of the target type.
+/// @param destination Where to write the widened integers
+/// @param count The number of integers to widen
+template <utils::tools::Integral Target>
+auto widen(const std::byte *source, std::size_t sourceSize, Target *destination, std::size_t count) -> void;
+
+/// @todo change list of extern template statements to the supported integer types
+extern template auto widen(const std::byte *source, std::size_t sourceSize, std::uint16_t *destination, std::size_t count) -> void;
+extern template auto widen(const std::byte *source, std::size_t sourceSize, std::uint32_t *destination, std::size_t count) -> void;
+extern template auto widen(const std::byte *source, std::size_t sourceSize, std::uint64_t *destination, std::size_t count) -> void;
+extern template auto widen(const std::byte *source, std::size_t sourceSize, std::int16_t *destination, std::size_t count) -> void;
+extern template auto widen(const std::byte *source, std::size_t sourceSize, std::int32_t *destination, std::size_t count) -> void;
+extern template auto widen(const std::byte *source, std::size_t sourceSize, std::int64_t *destination, std::size_t count) -> void;
+
+/// @brief Finds the values that differ from their previous values
+///
+/// The values are compared the same way as by the != operator, so that NaN values are always considered changed.
+/// @param newValues The new values
+/// @param oldValues The previous values
+/// @param count The number of values
+/// @param changes A bit mask with one bit per value, starting at the least significant bit of the first word. The mask must
+/// have room for at least (count + 63) / 64 words. The bits for values that changed are set, all other bits are left as they are.
+template <typename Value>
+auto findChanges(const Value *newValues, const Value *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+
+/// @todo change list of extern template statements to the supported integer and floating point types
+extern template auto findChanges(const std::uint8_t *newValues, const std::uint8_t *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+extern template auto findChanges(const std::uint16_t *newValues, const std::uint16_t *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+extern template auto findChanges(const std::uint32_t *newValues, const std::uint32_t *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+extern template auto findChanges(const std::uint64_t *newValues, const std::uint64_t *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+extern template auto findChanges(const std::int8_t *newValues, const std::int8_t *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+extern template auto findChanges(const std::int16_t *newValues, const std::int16_t *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+extern template auto findChanges(const std::int32_t *newValues, const std::int32_t *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+extern template auto findChanges(const std::int64_t *newValues, const std::int64_t *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+extern template auto findChanges(const float *newValues, const float *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+extern template auto findChanges(const double *newValues, const double *oldValues, std::size_t count, std::uint64_t *changes) -> void;
+
+} // namespace xentara::plugins::templateDriver::kernels
\ No newline at end of file
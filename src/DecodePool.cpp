@@ -0,0 +1,131 @@
+// Copyright (c) embedded ocean GmbH
+#include "DecodePool.hpp"
+
+namespace xentara::plugins::templateDriver
+{
+
+auto DecodePool::acquire(std::size_t threadCount) -> void
+{
+	std::scoped_lock lock { _configMutex };
+	++_userCount;
+
+	// Check if we have enough threads already
+	if (threadCount <= _threads.size())
+	{
+		return;
+	}
+
+	// Restart with the new number of threads
+	stop();
+	_slices = std::make_unique<Slice[]>(threadCount + 1);
+	_stopRequested = false;
+	_threads.reserve(threadCount);
+	// The threads must wait for the generation after the current one, even if the first job is started before they get to run
+	const auto generation = _generation.load(std::memory_order_relaxed);
+	for (std::size_t index = 0; index < threadCount; ++index)
+	{
+		// The calling thread of run() is participant 0, so the pool threads start at 1
+		_threads.emplace_back([this, participant = index + 1, generation] { run(participant, generation); });
+		applyThreadOptions(_threads.back(), _threadOptions, "-" + std::to_string(index + 1));
+	}
+}
+
+auto DecodePool::release() noexcept -> void
+{
+	std::scoped_lock lock { _configMutex };
+	if (_userCount > 0 && --_userCount == 0)
+	{
+		stop();
+	}
+}
+
+auto DecodePool::start(std::size_t count,
+	std::size_t participants,
+	void (*invoke)(void *context, std::size_t index, std::size_t participant),
+	void *context) noexcept -> void
+{
+	// Divide the indices evenly
+	for (std::size_t participant = 0; participant < participants; ++participant)
+	{
+		auto &slice = _slices[participant];
+		slice._next.store(count * participant / participants, std::memory_order_relaxed);
+		slice._end = count * (participant + 1) / participants;
+	}
+
+	_job = { invoke, context, participants };
+	// All the pool threads are woken up, so we need to wait for all of them, even the ones that don't participate,
+	// to make sure that they are done with the job before the next one is started
+	_pending.store(_threads.size(), std::memory_order_relaxed);
+
+	// Wake up the pool threads
+	_generation.fetch_add(1, std::memory_order_release);
+	_generation.notify_all();
+}
+
+auto DecodePool::work(std::size_t participant) noexcept -> void
+{
+	// Go through all the slices, starting with our own
+	const auto participants = _job._participants;
+	for (std::size_t offset = 0; offset < participants; ++offset)
+	{
+		auto &slice = _slices[(participant + offset) % participants];
+		for (auto index = slice._next.fetch_add(1, std::memory_order_relaxed); index < slice._end;
+			index = slice._next.fetch_add(1, std::memory_order_relaxed))
+		{
+			_job._invoke(_job._context, index, participant);
+		}
+	}
+}
+
+auto DecodePool::run(std::size_t participant, std::uint32_t generation) noexcept -> void
+{
+	auto cpuTime = currentThreadCpuTime();
+	while (true)
+	{
+		// Wait for the next job
+		_generation.wait(generation, std::memory_order_acquire);
+		generation = _generation.load(std::memory_order_acquire);
+		if (_stopRequested.load(std::memory_order_acquire))
+		{
+			break;
+		}
+
+		// Only the first few threads participate in small jobs
+		if (participant < _job._participants)
+		{
+			work(participant);
+
+			// Add the CPU time used to the total
+			const auto newCpuTime = currentThreadCpuTime();
+			_cpuTime.fetch_add(newCpuTime - cpuTime, std::memory_order_relaxed);
+			cpuTime = newCpuTime;
+		}
+
+		// Tell the calling thread if we were the last one
+		if (_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			_pending.notify_one();
+		}
+	}
+}
+
+auto DecodePool::stop() noexcept -> void
+{
+	if (_threads.empty())
+	{
+		return;
+	}
+
+	// Tell the threads to stop, and wake them up
+	_stopRequested.store(true, std::memory_order_release);
+	_generation.fetch_add(1, std::memory_order_release);
+	_generation.notify_all();
+
+	for (auto &&thread : _threads)
+	{
+		thread.join();
+	}
+	_threads.clear();
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
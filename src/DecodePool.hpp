@@ -0,0 +1,177 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "ThreadOptions.hpp"
+
+#include <xentara/utils/tools/Unique.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief A pool of threads that helps I/O transactions update large numbers of inputs in parallel
+///
+/// The work is a range of indices, which is divided into one slice per participating thread. Each thread works through
+/// its own slice first, and then steals the remaining indices from the slices of the other threads, so that the threads
+/// stay busy even if the items take different amounts of time.
+///
+/// The pool only runs one job at a time. If another job is already running, the work is done by the calling thread alone.
+class DecodePool final : private utils::tools::Unique
+{
+public:
+	/// @brief Constructor
+	/// @param threadOptions The CPU affinity, scheduling policy, and name of the threads. The threads are numbered by
+	/// appending a suffix to the name.
+	DecodePool(ThreadOptions threadOptions) :
+		_threadOptions(std::move(threadOptions))
+	{
+	}
+
+	/// @brief The destructor stops the threads
+	~DecodePool()
+	{
+		stop();
+	}
+
+	/// @brief Registers a user of the pool, and starts additional threads if necessary
+	///
+	/// This must only be done while the I/O transactions are being prepared, and no jobs are running.
+	/// @param threadCount The number of pool threads the user wants to use, in addition to its own thread
+	/// @throw std::system_error The thread options could not be applied
+	auto acquire(std::size_t threadCount) -> void;
+
+	/// @brief Unregisters a user of the pool, and stops the threads if it was the last one
+	auto release() noexcept -> void;
+
+	/// @brief Gets the total CPU time used by the pool threads, in seconds
+	///
+	/// The CPU time is updated whenever a thread has finished its part of a job.
+	auto cpuTime() const noexcept -> const std::atomic<double> &
+	{
+		return _cpuTime;
+	}
+
+	/// @brief Calls a function for each index in a range, using the calling thread and some of the pool threads
+	///
+	/// The function returns once the function has been called for all the indices.
+	/// @param count The number of indices
+	/// @param participants The maximum number of threads to use, including the calling thread
+	/// @param function The function. It is passed the index, and the number of the thread calling it, which is 0 for the
+	/// calling thread, and less than *participants* for the pool threads. The function must not throw any exceptions.
+	template <typename Function>
+	auto run(std::size_t count, std::size_t participants, Function &&function) noexcept -> void
+	{
+		// Use the pool only if it is not busy with another job
+		std::unique_lock lock { _runMutex, std::try_to_lock };
+		if (lock)
+		{
+			participants = std::min({ participants, _threads.size() + 1, count });
+		}
+		else
+		{
+			participants = 1;
+		}
+
+		// Do small jobs on the calling thread
+		if (participants <= 1)
+		{
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				function(index, 0);
+			}
+			return;
+		}
+
+		// Hand the job to the pool threads, and work on it ourselves
+		start(count, participants, [](void *context, std::size_t index, std::size_t participant)
+			{
+				(*static_cast<std::remove_reference_t<Function> *>(context))(index, participant);
+			}, &function);
+		work(0);
+
+		// Wait for the pool threads to finish
+		for (auto pending = _pending.load(std::memory_order_acquire); pending > 0; pending = _pending.load(std::memory_order_acquire))
+		{
+			_pending.wait(pending, std::memory_order_acquire);
+		}
+	}
+
+private:
+	/// @brief The part of the range of indices assigned to one thread
+	struct alignas(64) Slice final
+	{
+		/// @brief The next index to process
+		std::atomic<std::size_t> _next { 0 };
+		/// @brief The end of the slice
+		std::size_t _end { 0 };
+	};
+
+	/// @brief The current job
+	struct Job final
+	{
+		/// @brief The function that calls the function passed to run()
+		void (*_invoke)(void *context, std::size_t index, std::size_t participant) { nullptr };
+		/// @brief The function passed to run()
+		void *_context { nullptr };
+		/// @brief The number of participating threads, including the calling thread
+		std::size_t _participants { 0 };
+	};
+
+	/// @brief Divides the work into slices, and wakes up the pool threads
+	auto start(std::size_t count,
+		std::size_t participants,
+		void (*invoke)(void *context, std::size_t index, std::size_t participant),
+		void *context) noexcept -> void;
+
+	/// @brief Works on a job, starting with the slice of a participant and then stealing from the others
+	auto work(std::size_t participant) noexcept -> void;
+
+	/// @brief The main function of a pool thread
+	/// @param participant The number of the thread
+	/// @param generation The value of the generation counter when the thread was started
+	auto run(std::size_t participant, std::uint32_t generation) noexcept -> void;
+
+	/// @brief Stops the threads
+	auto stop() noexcept -> void;
+
+	/// @brief The options for the threads
+	ThreadOptions _threadOptions;
+
+	/// @brief A mutex protecting the configuration of the threads
+	std::mutex _configMutex;
+	/// @brief The number of registered users
+	std::size_t _userCount { 0 };
+
+	/// @brief A mutex that makes sure that only one job runs at a time
+	std::mutex _runMutex;
+	/// @brief The current job
+	Job _job;
+	/// @brief The slices of the current job, one for each possible participant
+	std::unique_ptr<Slice[]> _slices;
+	/// @brief The number of pool threads that have not finished the current job yet
+	std::atomic<std::size_t> _pending { 0 };
+
+	/// @brief A counter that is incremented for each job, used with std::atomic::wait()
+	std::atomic<std::uint32_t> _generation { 0 };
+	/// @brief Whether the threads should stop
+	std::atomic<bool> _stopRequested { false };
+
+	/// @brief The total CPU time of the threads, in seconds
+	std::atomic<double> _cpuTime { 0.0 };
+
+	/// @brief The threads
+	std::vector<std::thread> _threads;
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -17,4 +17,13 @@ const process::Event::Role kRead { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid,
 /// @todo assign a unique UUID
 const process::Event::Role kWritten { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "written"sv };
 
+/// @todo assign a unique UUID
+const process::Event::Role kReadOverrun { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readOverrun"sv };
+
+/// @todo assign a unique UUID
+const process::Event::Role kWriteOverrun { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writeOverrun"sv };
+
+/// @todo assign a unique UUID
+const process::Event::Role kExchangeOverrun { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "exchangeOverrun"sv };
+
 } // namespace xentara::plugins::templateDriver::events
\ No newline at end of file
@@ -11,5 +11,11 @@ namespace xentara::plugins::templateDriver::events
 extern const process::Event::Role kRead;
 /// @brief A Xentara event that is raised when a data point was written
 extern const process::Event::Role kWritten;
+/// @brief A Xentara event that is raised when the read task of a transaction overran
+extern const process::Event::Role kReadOverrun;
+/// @brief A Xentara event that is raised when the write task of a transaction overran
+extern const process::Event::Role kWriteOverrun;
+/// @brief A Xentara event that is raised when the exchange task of a transaction overran
+extern const process::Event::Role kExchangeOverrun;
 
 } // namespace xentara::plugins::templateDriver::events
\ No newline at end of file
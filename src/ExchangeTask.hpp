@@ -0,0 +1,99 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <xentara/process/Task.hpp>
+#include <xentara/process/ExecutionContext.hpp>
+
+#include <chrono>
+#include <functional>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief This class providing callbacks for the Xentara scheduler for the "exchange" task of I/O transactions
+template <typename Target>
+class ExchangeTask final : public process::Task
+{
+public:
+	/// @brief This constuctor attached the task to its target
+	ExchangeTask(std::reference_wrapper<Target> target) : _target(target)
+	{
+	}
+
+	/// @name Virtual Overrides for process::Task
+	/// @{
+
+	auto stages() const -> Stages final
+	{
+		return Stage::PreOperational | Stage::Operational | Stage::PostOperational;
+	}
+
+	auto preparePreOperational(const process::ExecutionContext &context) -> Status final;
+
+	auto preOperational(const process::ExecutionContext &context) -> Status final;
+
+	auto operational(const process::ExecutionContext &context) -> void final;
+
+	auto preparePostOperational(const process::ExecutionContext &context) -> Status final;
+
+	auto postOperational(const process::ExecutionContext &context) -> Status final;
+
+	auto finishPostOperational(const process::ExecutionContext &context) -> void final;
+		
+	/// @}
+
+private:
+	/// @brief A reference to the target element
+	std::reference_wrapper<Target> _target;
+};
+
+template <typename Target>
+auto ExchangeTask<Target>::preparePreOperational(const process::ExecutionContext &context) -> Status
+{
+	// Exchange the data once to initialize the inputs
+	operational(context);
+
+	// We are done now. Even if we couldn't read the value, we proceed to the next stage,
+	// because attempting again is unlikely to succeed any better.
+	return Status::Ready;
+}
+
+template <typename Target>
+auto ExchangeTask<Target>::preOperational(const process::ExecutionContext &context) -> Status
+{
+	// We just do the same thing as in the operational stage
+	operational(context);
+
+	return Status::Ready;
+}
+
+template <typename Target>
+auto ExchangeTask<Target>::operational(const process::ExecutionContext &context) -> void
+{
+	_target.get().performExchangeTask(context);
+}
+
+template <typename Target>
+auto ExchangeTask<Target>::preparePostOperational([[maybe_unused]] const process::ExecutionContext &context) -> Status
+{
+	// Everything in the post operational stage is optional, so we can report ready right away
+	return Status::Ready;
+}
+
+template <typename Target>
+auto ExchangeTask<Target>::postOperational(const process::ExecutionContext &context) -> Status
+{
+	// We just do the same thing as in the operational stage
+	operational(context);
+
+	return Status::Ready;
+}
+
+template <typename Target>
+auto ExchangeTask<Target>::finishPostOperational(const process::ExecutionContext &context) -> void
+{
+	// Invalidate the data, since we are no longer acquiring it
+	_target.get().invalidateData(context.scheduledTime());
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,99 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "AbstractIoRequest.hpp"
+
+#include <xentara/utils/tools/Unique.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <semaphore>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief A ring the I/O worker uses to report completed requests back to their owner.
+///
+/// The ring has a single producer, which is the I/O worker thread, and a single consumer, which is the task that submitted
+/// the requests. The consumer can block until a completion arrives, optionally with a deadline. All memory is allocated by reset().
+class IoCompletionRing final : private utils::tools::Unique
+{
+public:
+	/// @brief Allocates the ring, and clears it. This must not be called while requests are outstanding.
+	/// @param capacity The maximum number of requests that can be outstanding at the same time
+	auto reset(std::size_t capacity) -> void
+	{
+		_capacity = capacity + 1;
+		_slots = std::make_unique<AbstractIoRequest *[]>(_capacity);
+		_head = 0;
+		_tail.store(0, std::memory_order_relaxed);
+		while (_available.try_acquire())
+		{
+		}
+	}
+
+	/// @brief Reports a completed request. This is called by the I/O worker thread.
+	/// @param request The completed request. The ring cannot overflow as long as no more requests are outstanding than the
+	/// capacity passed to reset().
+	auto push(AbstractIoRequest &request) noexcept -> void
+	{
+		const auto tail = _tail.load(std::memory_order_relaxed);
+		_slots[tail] = &request;
+		_tail.store(next(tail), std::memory_order_release);
+		_available.release();
+	}
+
+	/// @brief Waits for the next completed request. This is called by the owner of the requests.
+	/// @return The completed request
+	auto wait() noexcept -> AbstractIoRequest &
+	{
+		_available.acquire();
+		return take();
+	}
+
+	/// @brief Waits for the next completed request, up to a deadline. This is called by the owner of the requests.
+	/// @param deadline The time to give up waiting
+	/// @return The completed request, or nullptr if no request completed before the deadline
+	auto waitUntil(std::chrono::steady_clock::time_point deadline) noexcept -> AbstractIoRequest *
+	{
+		if (!_available.try_acquire_until(deadline))
+		{
+			return nullptr;
+		}
+		return &take();
+	}
+
+private:
+	/// @brief Takes the request from the head slot, after a completion has been acquired from the semaphore
+	auto take() noexcept -> AbstractIoRequest &
+	{
+		// The semaphore synchronizes with push(), so the slot has been written. Load the tail anyway, to make this explicit.
+		[[maybe_unused]] const auto tail = _tail.load(std::memory_order_acquire);
+
+		auto &request = *_slots[_head];
+		_head = next(_head);
+		return request;
+	}
+
+	/// @brief Gets the index of the slot following another one
+	auto next(std::size_t index) const noexcept -> std::size_t
+	{
+		return index + 1 == _capacity ? 0 : index + 1;
+	}
+
+	/// @brief The slots
+	std::unique_ptr<AbstractIoRequest *[]> _slots;
+	/// @brief The number of slots
+	std::size_t _capacity { 0 };
+	/// @brief The slot the next completion will be read from. This is only used by the consumer.
+	std::size_t _head { 0 };
+	/// @brief The slot the next completion will be written to
+	std::atomic<std::size_t> _tail { 0 };
+	/// @brief The number of completions that have been pushed, but not taken yet
+	std::counting_semaphore<> _available { 0 };
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
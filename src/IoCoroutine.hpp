@@ -0,0 +1,209 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "AbstractIoRequest.hpp"
+#include "IoCompletionRing.hpp"
+
+#include <xentara/utils/tools/Unique.hpp>
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief Preallocated memory for the frame of an I/O coroutine
+///
+/// If one of the parameters of an I/O coroutine is derived from this class, the frame of the coroutine is placed in this
+/// memory, so that starting the coroutine does not allocate any memory. Only one coroutine can use the memory at a time.
+/// If the frame is too large, or the memory is in use, the frame is allocated on the heap instead.
+class IoCoroutineFrame : private utils::tools::Unique
+{
+public:
+	/// @brief The size of the memory
+	static constexpr std::size_t kSize = 1024;
+
+private:
+	/// @brief The memory
+	alignas(std::max_align_t) std::byte _storage[kSize];
+	/// @brief Whether a coroutine is currently using the memory
+	bool _inUse { false };
+
+	friend class IoCoroutine;
+};
+
+/// @brief The return type of coroutines that perform I/O
+///
+/// I/O coroutines allow sequences of requests, like retries of failed requests, to be written as straight-line code. When the
+/// coroutine awaits a request, it is suspended until the request has completed, and then resumed by the thread that completed
+/// it, which is usually the I/O worker of the I/O component. No thread is blocked in the meantime.
+///
+/// The coroutine does not run until start() is called. Once it has finished, it reports the completion of the request passed to
+/// start() to a completion ring, so that the owner of the coroutine can wait for it like for any other request.
+class IoCoroutine final
+{
+public:
+	/// @brief The promise type of the coroutine
+	class promise_type final
+	{
+	public:
+		/// @brief Allocates the frame, using the memory of the first parameter derived from IoCoroutineFrame, if there is one
+		template <typename... Parameters>
+		static auto operator new(std::size_t size, Parameters &...parameters) -> void *
+		{
+			IoCoroutineFrame *frame { nullptr };
+			((frame = findFrame(frame, parameters)), ...);
+
+			// Use the preallocated memory, if possible. A header before the frame records where the frame came from.
+			if (frame && !frame->_inUse && size + kHeaderSize <= IoCoroutineFrame::kSize)
+			{
+				frame->_inUse = true;
+				return initialize(frame->_storage, frame);
+			}
+			return initialize(::operator new(size + kHeaderSize), nullptr);
+		}
+
+		/// @brief Frees the frame
+		static auto operator delete(void *pointer) noexcept -> void
+		{
+			auto *header = static_cast<std::byte *>(pointer) - kHeaderSize;
+			if (auto *frame = *reinterpret_cast<IoCoroutineFrame **>(header))
+			{
+				frame->_inUse = false;
+			}
+			else
+			{
+				::operator delete(header);
+			}
+		}
+
+		/// @brief Gets the coroutine object
+		auto get_return_object() noexcept -> IoCoroutine
+		{
+			return IoCoroutine { std::coroutine_handle<promise_type>::from_promise(*this) };
+		}
+
+		/// @brief The coroutine does not run until start() is called
+		auto initial_suspend() const noexcept -> std::suspend_always
+		{
+			return {};
+		}
+
+		/// @brief Destroys the coroutine and reports the completion
+		auto final_suspend() const noexcept
+		{
+			struct Awaiter final
+			{
+				auto await_ready() const noexcept -> bool
+				{
+					return false;
+				}
+
+				auto await_suspend(std::coroutine_handle<promise_type> handle) const noexcept -> void
+				{
+					// Destroy the frame before reporting the completion, because the owner may start a new coroutine
+					// in the same memory as soon as it sees the completion
+					auto &completions = *handle.promise()._completions;
+					auto &request = *handle.promise()._request;
+					handle.destroy();
+
+					completions.push(request);
+				}
+
+				auto await_resume() const noexcept -> void
+				{
+				}
+			};
+
+			return Awaiter {};
+		}
+
+		/// @brief Called when the coroutine returns
+		auto return_void() const noexcept -> void
+		{
+		}
+
+		/// @brief Called if the coroutine throws an exception. I/O coroutines must handle all errors themselves.
+		auto unhandled_exception() const noexcept -> void
+		{
+			std::terminate();
+		}
+
+	private:
+		/// @brief The size of the header before the frame
+		static constexpr std::size_t kHeaderSize = alignof(std::max_align_t);
+
+		/// @brief Checks if a parameter is derived from IoCoroutineFrame
+		template <typename Parameter>
+		static auto findFrame(IoCoroutineFrame *found, Parameter &parameter) noexcept -> IoCoroutineFrame *
+		{
+			if constexpr (std::is_base_of_v<IoCoroutineFrame, std::remove_cv_t<Parameter>>)
+			{
+				return found ? found : &static_cast<IoCoroutineFrame &>(parameter);
+			}
+			else
+			{
+				return found;
+			}
+		}
+
+		/// @brief Writes the header to a block of memory, and returns a pointer to the frame following it
+		static auto initialize(void *memory, IoCoroutineFrame *frame) noexcept -> void *
+		{
+			*static_cast<IoCoroutineFrame **>(memory) = frame;
+			return static_cast<std::byte *>(memory) + kHeaderSize;
+		}
+
+		/// @brief The ring to report the completion to
+		IoCompletionRing *_completions { nullptr };
+		/// @brief The request to report as completed
+		AbstractIoRequest *_request { nullptr };
+
+		friend class IoCoroutine;
+	};
+
+	/// @brief The move constructor takes over the coroutine
+	IoCoroutine(IoCoroutine &&other) noexcept : _handle(std::exchange(other._handle, {}))
+	{
+	}
+
+	/// @brief Assignment is not supported
+	auto operator=(IoCoroutine &&) -> IoCoroutine & = delete;
+
+	/// @brief The destructor destroys the coroutine, if it was never started
+	~IoCoroutine()
+	{
+		if (_handle)
+		{
+			_handle.destroy();
+		}
+	}
+
+	/// @brief Runs the coroutine until it awaits a request for the first time
+	/// @param completions The ring to report the completion to, once the coroutine has finished
+	/// @param request The request to report as completed
+	auto start(IoCompletionRing &completions, AbstractIoRequest &request) noexcept -> void
+	{
+		auto &promise = _handle.promise();
+		promise._completions = &completions;
+		promise._request = &request;
+
+		// The coroutine is no longer ours once it runs, because it destroys itself when it has finished
+		std::exchange(_handle, {}).resume();
+	}
+
+private:
+	/// @brief This constructor is used by the promise
+	explicit IoCoroutine(std::coroutine_handle<promise_type> handle) noexcept : _handle(handle)
+	{
+	}
+
+	/// @brief The coroutine, or a default constructed handle if it has been started
+	std::coroutine_handle<promise_type> _handle;
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
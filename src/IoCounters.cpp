@@ -0,0 +1,54 @@
+// Copyright (c) embedded ocean GmbH
+#include "IoCounters.hpp"
+
+#include "Attributes.hpp"
+
+namespace xentara::plugins::templateDriver
+{
+
+namespace
+{
+
+/// @brief The attributes of the counters, in the order of IoCounter
+const std::array<const model::Attribute *, kIoCounterCount> kCounterAttributes {
+	&attributes::kReadCount,
+	&attributes::kWriteCount,
+	&attributes::kFailedReadCount,
+	&attributes::kFailedWriteCount,
+	&attributes::kBytesSent,
+	&attributes::kBytesReceived,
+	&attributes::kReadCommandsIssued,
+	&attributes::kRetryCount,
+	&attributes::kTimeoutCount,
+	&attributes::kChangedInputCount
+};
+
+} // namespace
+
+auto IoCounters::forEachAttribute(const model::ForEachAttributeFunction &function) const -> bool
+{
+	for (auto &&attribute : kCounterAttributes)
+	{
+		if (function(*attribute))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+auto IoCounters::makeReadHandle(const model::Attribute &attribute) const noexcept -> std::optional<data::ReadHandle>
+{
+	for (std::size_t index = 0; index < kIoCounterCount; ++index)
+	{
+		if (attribute == *kCounterAttributes[index])
+		{
+			return data::ReadHandle { _counters[index] };
+		}
+	}
+
+	return std::nullopt;
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,81 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <xentara/data/ReadHandle.hpp>
+#include <xentara/model/Attribute.hpp>
+#include <xentara/model/ForEachAttributeFunction.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief The operations counted by IoCounters
+enum class IoCounter : std::size_t
+{
+	/// @brief Reads that executed the read commands. Invalidating the inputs, and reads of a polling group that missed
+	/// their deadline, are not counted.
+	Reads,
+	/// @brief Writes performed
+	Writes,
+	/// @brief Reads that failed
+	FailedReads,
+	/// @brief Writes that failed
+	FailedWrites,
+	/// @brief Bytes actually sent to the I/O component, including protocol overhead
+	BytesSent,
+	/// @brief Bytes actually received from the I/O component, including protocol overhead
+	BytesReceived,
+	/// @brief Read commands issued
+	ReadCommands,
+	/// @brief Requests that were retried
+	Retries,
+	/// @brief Request attempts that timed out, and reads of a polling group that missed their deadline
+	Timeouts,
+	/// @brief Input values that changed when they were read. This includes the read back input values of outputs,
+	/// but not the output values written.
+	InputsChanged
+};
+
+/// @brief The number of counters in IoCounters
+constexpr std::size_t kIoCounterCount = std::size_t(IoCounter::InputsChanged) + 1;
+
+/// @brief Operational counters of an I/O transaction or an I/O component
+///
+/// The counters are updated on the hot path, so they use relaxed atomics. They only ever grow, and are published as
+/// read-only attributes.
+class IoCounters final
+{
+public:
+	/// @brief Adds to a counter
+	auto add(IoCounter counter, std::uint64_t amount = 1) noexcept -> void
+	{
+		_counters[std::size_t(counter)].fetch_add(amount, std::memory_order_relaxed);
+	}
+
+	/// @brief Gets the current value of a counter
+	auto value(IoCounter counter) const noexcept -> std::uint64_t
+	{
+		return _counters[std::size_t(counter)].load(std::memory_order_relaxed);
+	}
+
+	/// @brief Iterates over all the attributes that belong to the counters.
+	/// @param function The function that should be called for each attribute
+	/// @return The return value of the last function call
+	auto forEachAttribute(const model::ForEachAttributeFunction &function) const -> bool;
+
+	/// @brief Creates a read-handle for an attribute that belongs to the counters.
+	/// @param attribute The attribute to create the handle for
+	/// @return A read handle for the attribute, or std::nullopt if the attribute is unknown
+	auto makeReadHandle(const model::Attribute &attribute) const noexcept -> std::optional<data::ReadHandle>;
+
+private:
+	/// @brief The counters, in the order of IoCounter
+	std::array<std::atomic<std::uint64_t>, kIoCounterCount> _counters {};
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
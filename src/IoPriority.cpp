@@ -0,0 +1,43 @@
+// Copyright (c) embedded ocean GmbH
+#include "IoPriority.hpp"
+
+#include <xentara/utils/json/decoder/Errors.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace xentara::plugins::templateDriver
+{
+
+using namespace std::literals;
+
+auto loadIoPriority(utils::json::decoder::Value &value) -> IoPriority
+{
+	// Get the keyword from the value
+	auto keyword = value.asString<std::string>();
+
+	if (keyword == "control"sv)
+	{
+		return IoPriority::Control;
+	}
+	else if (keyword == "normal"sv)
+	{
+		return IoPriority::Normal;
+	}
+	else if (keyword == "bulk"sv)
+	{
+		return IoPriority::Bulk;
+	}
+
+	// The keyword is not known
+	else
+	{
+		/// @todo replace "template I/O transaction" with a more descriptive name
+		utils::json::decoder::throwWithLocation(value, std::runtime_error("unknown priority in template I/O transaction"));
+	}
+
+	return IoPriority::Normal;
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,42 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <xentara/utils/json/decoder/Value.hpp>
+
+#include <cstddef>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief The priority class of the requests of a transaction
+///
+/// Requests of the Control class are always sent first. The remaining classes share the rest of the I/O component's
+/// capacity according to their weights.
+enum class IoPriority
+{
+	/// @brief Requests of fast control loops. These always overtake all other requests.
+	Control,
+	/// @brief Normal requests. Write requests always use at least this class.
+	Normal,
+	/// @brief Bulk requests, like diagnostic polls
+	Bulk
+};
+
+/// @brief The number of priority classes
+constexpr std::size_t kIoPriorityCount = 3;
+
+/// @brief The weights used to share the capacity between the Normal and Bulk priority classes
+struct IoPriorityWeights final
+{
+	/// @brief The number of Normal requests sent for each round
+	std::size_t _normal { 4 };
+	/// @brief The number of Bulk requests sent for each round
+	std::size_t _bulk { 1 };
+};
+
+/// @brief Loads a priority class from a configuration value
+/// @param value The JSON value to load the priority class from
+/// @return The priority class. If the value contains an unknown keyword, an exception is thrown.
+auto loadIoPriority(utils::json::decoder::Value &value) -> IoPriority;
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
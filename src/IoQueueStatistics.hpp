@@ -0,0 +1,66 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "IoPriority.hpp"
+
+#include <xentara/utils/tools/Unique.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief Statistics about the I/O worker serving an I/O component, including the time its requests wait in the queue
+///
+/// The statistics are updated by the I/O worker thread only, and can be read by any thread.
+class IoQueueStatistics final : private utils::tools::Unique
+{
+public:
+	/// @brief Records the time a request waited in the queue
+	/// @param priority The priority class of the request
+	/// @param waitTime The time between submitting and sending the request
+	auto record(IoPriority priority, std::chrono::steady_clock::duration waitTime) noexcept -> void
+	{
+		auto &average = _averageWaitTimes[std::size_t(priority)];
+		const auto seconds = std::chrono::duration<double>(waitTime).count();
+
+		// Use an exponential moving average, so that the value reflects the recent behaviour
+		const auto previous = average.load(std::memory_order_relaxed);
+		average.store(previous + (seconds - previous) * kSmoothingFactor, std::memory_order_relaxed);
+	}
+
+	/// @brief Gets the average wait time of a priority class, in seconds
+	auto averageWaitTime(IoPriority priority) const noexcept -> const std::atomic<double> &
+	{
+		return _averageWaitTimes[std::size_t(priority)];
+	}
+
+	/// @brief Records the CPU time used by the I/O worker thread so far
+	/// @param seconds The CPU time, in seconds
+	auto recordThreadCpuTime(double seconds) noexcept -> void
+	{
+		_threadCpuTime.store(seconds, std::memory_order_relaxed);
+	}
+
+	/// @brief Gets the CPU time used by the I/O worker thread, in seconds
+	///
+	/// If the I/O worker is shared by several I/O components, this is the CPU time of the shared thread.
+	auto threadCpuTime() const noexcept -> const std::atomic<double> &
+	{
+		return _threadCpuTime;
+	}
+
+private:
+	/// @brief The weight of each new sample in the moving average
+	static constexpr double kSmoothingFactor = 1.0 / 16.0;
+
+	/// @brief The average wait times, in seconds, by priority class
+	std::array<std::atomic<double>, kIoPriorityCount> _averageWaitTimes {};
+	/// @brief The CPU time of the I/O worker thread, in seconds
+	std::atomic<double> _threadCpuTime { 0.0 };
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,658 @@
+// Copyright (c) embedded ocean GmbH
+#include "IoWorker.hpp"
+
+#include "CustomError.hpp"
+
+#include <xentara/utils/eh/currentErrorCode.hpp>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <system_error>
+
+#if defined(__linux__)
+#	include <sys/epoll.h>
+#	include <sys/eventfd.h>
+#	include <unistd.h>
+#	include <cerrno>
+#endif
+
+namespace xentara::plugins::templateDriver
+{
+
+namespace
+{
+
+#if defined(__linux__)
+	/// @brief The maximum number of ready connections handled per call to epoll_wait()
+	constexpr std::size_t kMaxReadyConnections = 256;
+#endif
+
+} // namespace
+
+auto IoWorker::addConnection(AbstractIoConnection &connection, std::size_t pipelineDepth) -> void
+{
+	auto &state = _connections[&connection];
+	state._connection = &connection;
+	state._inFlight.assign(std::max(pipelineDepth, std::size_t(1)), {});
+	state._timedOut.assign(state._inFlight.size(), {});
+	state._nextRequestId = 0;
+}
+
+auto IoWorker::removeConnection(AbstractIoConnection &connection) noexcept -> void
+{
+	_connections.erase(&connection);
+}
+
+auto IoWorker::start(std::size_t queueSize, const IoPriorityWeights &weights, const ThreadOptions &threadOptions) -> void
+{
+	stop();
+
+	// Each queue must be able to hold all the requests, since all of them may have the same priority
+	for (auto &&queue : _queues)
+	{
+		queue.reset(queueSize);
+	}
+	_weights = weights;
+	_normalCredit = 0;
+	_bulkCredit = 0;
+
+	// Any request that is queued may have to be parked, so make room for all of them, and link all the entries into the free list
+	_parkedRequests.assign(queueSize, {});
+	for (std::size_t index = 0; index + 1 < queueSize; ++index)
+	{
+		_parkedRequests[index]._next = index + 1;
+	}
+	_freeParkedRequest = queueSize > 0 ? 0 : kNoParkedRequest;
+
+#if defined(__linux__)
+	// Create the epoll instance, and the event used to wake up the thread while it waits for the connections
+	_epoll = ::epoll_create1(EPOLL_CLOEXEC);
+	if (_epoll < 0)
+	{
+		throw std::system_error(errno, std::generic_category(), "could not create the epoll instance of the I/O worker");
+	}
+	_wakeUpEvent = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+	if (_wakeUpEvent < 0)
+	{
+		const auto error = errno;
+		closePoller();
+		throw std::system_error(error, std::generic_category(), "could not create the wake-up event of the I/O worker");
+	}
+	::epoll_event event {};
+	event.events = EPOLLIN;
+	event.data.ptr = nullptr;
+	if (::epoll_ctl(_epoll, EPOLL_CTL_ADD, _wakeUpEvent, &event) != 0)
+	{
+		const auto error = errno;
+		closePoller();
+		throw std::system_error(error, std::generic_category(), "could not register the wake-up event of the I/O worker");
+	}
+#endif
+
+	// Reset the connections, and register their poll handles
+	_pipelineDepth = 0;
+	for (auto &&[connection, state] : _connections)
+	{
+		std::ranges::fill(state._inFlight, InFlightRequest {});
+		state._inFlightCount = 0;
+		std::ranges::fill(state._timedOut, TimedOutRequest {});
+		state._nextTimedOut = 0;
+		state._parked = {};
+		state._previousBlocking = nullptr;
+		state._nextBlocking = nullptr;
+		state._polled = false;
+		state._pollHandle = connection->pollHandle();
+		poll(state);
+		_pipelineDepth += state._inFlight.size();
+	}
+	_inFlightCount = 0;
+	_nextDeadline = std::chrono::steady_clock::time_point::max();
+	_firstBlocking = nullptr;
+	_lastBlocking = nullptr;
+
+	_sendsSinceCpuTimeRecord = 0;
+	_stopRequested = false;
+	_thread = std::thread([this] { run(); });
+	applyThreadOptions(_thread, threadOptions);
+}
+
+auto IoWorker::stop() noexcept -> void
+{
+	// Check if the thread is running at all
+	if (!_thread.joinable())
+	{
+		return;
+	}
+
+	// Tell the thread to stop, and wake it up
+	_stopRequested.store(true, std::memory_order_release);
+	_wakeUpCount.fetch_add(1, std::memory_order_release);
+	_wakeUpCount.notify_one();
+
+	_thread.join();
+
+	closePoller();
+}
+
+auto IoWorker::closePoller() noexcept -> void
+{
+#if defined(__linux__)
+	if (_wakeUpEvent >= 0)
+	{
+		::close(_wakeUpEvent);
+		_wakeUpEvent = -1;
+	}
+	if (_epoll >= 0)
+	{
+		::close(_epoll);
+		_epoll = -1;
+	}
+#endif
+}
+
+auto IoWorker::submit(AbstractIoRequest &request,
+	IoPriority priority,
+	IoQueueStatistics &statistics,
+	std::chrono::steady_clock::time_point deadline) -> void
+{
+	// Look up the connection here rather than on the thread, to keep the work of the thread to a minimum
+	const auto connection = _connections.find(&request.connection());
+	if (connection == _connections.end()) [[unlikely]]
+	{
+		throw std::logic_error("internal error: request submitted for a connection that is not registered with the I/O worker");
+	}
+
+	const QueuedRequest entry { &request, &connection->second, &statistics, std::chrono::steady_clock::now(), deadline };
+	if (!_queues[std::size_t(priority)].tryPush(entry)) [[unlikely]]
+	{
+		throw std::system_error(CustomError::IoQueueFull);
+	}
+
+	// Wake up the thread. If it is waiting for connections, it must be woken up using the event instead. The sequentially
+	// consistent operations make sure that either we see that the thread is polling, or the thread sees the new wake-up count.
+	_wakeUpCount.fetch_add(1, std::memory_order_seq_cst);
+	_wakeUpCount.notify_one();
+#if defined(__linux__)
+	if (_polling.exchange(false, std::memory_order_seq_cst))
+	{
+		const std::uint64_t increment { 1 };
+		// The write can only fail if the counter overflows, in which case the thread will wake up anyway
+		static_cast<void>(::write(_wakeUpEvent, &increment, sizeof(increment)));
+	}
+#endif
+}
+
+auto IoWorker::run() noexcept -> void
+{
+	while (true)
+	{
+		// Remember the wake-up count before draining the queue. If a request is submitted after we checked the queue,
+		// the count will have changed, and wait() will return immediately.
+		const auto wakeUpCount = _wakeUpCount.load(std::memory_order_acquire);
+
+		// Send as many queued requests as the pipelining depths of the connections allow. Requests for connections whose
+		// pipeline is full are parked, so that they do not hold up the requests for other connections.
+		while (_inFlightCount < _pipelineDepth)
+		{
+			const auto next = popNext();
+			if (!next)
+			{
+				break;
+			}
+
+			const auto &[entry, priority] = *next;
+			dispatch(entry, priority);
+		}
+
+		// Fail the requests whose deadline has passed. This frees their slots, so check the queue again afterwards.
+		if (_nextDeadline != std::chrono::steady_clock::time_point::max())
+		{
+			if (const auto now = std::chrono::steady_clock::now(); now >= _nextDeadline)
+			{
+				expireRequests(now);
+				continue;
+			}
+		}
+
+		// If there are requests in flight, receive the responses that are ready, and then check the queue again
+		if (_inFlightCount > 0)
+		{
+			receiveReady(wakeUpCount);
+			continue;
+		}
+
+		// Stop once the queue is empty and all responses have been received
+		if (_stopRequested.load(std::memory_order_acquire))
+		{
+			break;
+		}
+
+		// Record the CPU time before becoming idle
+		recordCpuTime();
+
+		_wakeUpCount.wait(wakeUpCount, std::memory_order_acquire);
+	}
+}
+
+auto IoWorker::addStatistics(IoQueueStatistics &statistics) -> void
+{
+	std::scoped_lock lock { _statisticsMutex };
+	_statistics.push_back(&statistics);
+}
+
+auto IoWorker::removeStatistics(IoQueueStatistics &statistics) noexcept -> void
+{
+	std::scoped_lock lock { _statisticsMutex };
+	std::erase(_statistics, &statistics);
+}
+
+auto IoWorker::recordCpuTime() noexcept -> void
+{
+	// All the I/O components sharing the thread get the same value, so that none of them shows a stale one
+	const auto cpuTime = currentThreadCpuTime();
+	{
+		std::scoped_lock lock { _statisticsMutex };
+		for (auto &&statistics : _statistics)
+		{
+			statistics->recordThreadCpuTime(cpuTime);
+		}
+	}
+	_sendsSinceCpuTimeRecord = 0;
+}
+
+auto IoWorker::popNext() noexcept -> std::optional<std::pair<QueuedRequest, IoPriority>>
+{
+	// Control requests always go first
+	if (auto entry = _queues[std::size_t(IoPriority::Control)].tryPop())
+	{
+		return std::pair(*entry, IoPriority::Control);
+	}
+
+	// Share the rest between the Normal and Bulk classes in rounds. Each class may send as many requests per round as its weight.
+	// A class whose queue is empty forfeits the rest of its credit, so that it cannot send a burst later on.
+	// If both classes are out of credit, a new round is started, and the queues are checked once more.
+	for (auto round = 0; round < 2; ++round)
+	{
+		if (_normalCredit > 0)
+		{
+			if (auto entry = _queues[std::size_t(IoPriority::Normal)].tryPop())
+			{
+				--_normalCredit;
+				return std::pair(*entry, IoPriority::Normal);
+			}
+			_normalCredit = 0;
+		}
+		if (_bulkCredit > 0)
+		{
+			if (auto entry = _queues[std::size_t(IoPriority::Bulk)].tryPop())
+			{
+				--_bulkCredit;
+				return std::pair(*entry, IoPriority::Bulk);
+			}
+			_bulkCredit = 0;
+		}
+
+		_normalCredit = _weights._normal;
+		_bulkCredit = _weights._bulk;
+	}
+
+	return std::nullopt;
+}
+
+auto IoWorker::dispatch(const QueuedRequest &entry, IoPriority priority) noexcept -> void
+{
+	auto &connection = *entry._connection;
+
+	// Send the request right away if the connection has a free slot
+	if (connection._inFlightCount < connection._inFlight.size())
+	{
+		send(entry, priority);
+		return;
+	}
+
+	// Park the request. There is always a free entry, because every request that can be queued has one.
+	const auto index = _freeParkedRequest;
+	if (index == kNoParkedRequest) [[unlikely]]
+	{
+		entry._request->fail(CustomError::IoQueueFull);
+		return;
+	}
+	auto &parked = _parkedRequests[index];
+	_freeParkedRequest = parked._next;
+	parked = { entry, kNoParkedRequest };
+	_nextDeadline = std::min(_nextDeadline, entry._deadline);
+
+	// Append it to the list for its priority class
+	auto &list = connection._parked[std::size_t(priority)];
+	if (list._last != kNoParkedRequest)
+	{
+		_parkedRequests[list._last]._next = index;
+	}
+	else
+	{
+		list._first = index;
+	}
+	list._last = index;
+}
+
+auto IoWorker::send(const QueuedRequest &entry, IoPriority priority) noexcept -> void
+{
+	// Record how long the request waited before sending it
+	const auto now = std::chrono::steady_clock::now();
+	entry._statistics->record(priority, now - entry._submitTime);
+
+	// Don't send requests whose response could not arrive in time anyway
+	auto &request = *entry._request;
+	if (entry._deadline <= now)
+	{
+		request.fail(CustomError::Timeout);
+		return;
+	}
+
+	// Record the CPU time every now and then, in case the thread is never idle
+	if (++_sendsSinceCpuTimeRecord >= kCpuTimeRecordInterval)
+	{
+		recordCpuTime();
+	}
+
+	// Make sure we will be notified about the response, in case the connection was removed from the epoll instance after a failure
+	auto &connection = *entry._connection;
+	if (!connection._polled)
+	{
+		poll(connection);
+	}
+
+	// Send the request. If this fails, the request has already reported its completion, and the ID is used for the next request,
+	// so that the IDs of the requests actually sent over the connection remain consecutive.
+	const auto requestId = connection._nextRequestId;
+	if (!request.send(requestId))
+	{
+		return;
+	}
+	++connection._nextRequestId;
+
+	// Record it in a free slot
+	const auto slot = std::ranges::find(connection._inFlight, nullptr, &InFlightRequest::_request);
+	*slot = { &request, requestId, entry._deadline };
+	_nextDeadline = std::min(_nextDeadline, entry._deadline);
+	++_inFlightCount;
+	if (++connection._inFlightCount == 1 && !connection._polled)
+	{
+		appendBlocking(connection);
+	}
+}
+
+auto IoWorker::sendParked(ConnectionState &connection) noexcept -> void
+{
+	// Send the parked requests in order of priority. The classes are ordered by decreasing priority.
+	for (std::size_t priority = 0; priority < kIoPriorityCount; ++priority)
+	{
+		auto &list = connection._parked[priority];
+		while (list._first != kNoParkedRequest && connection._inFlightCount < connection._inFlight.size())
+		{
+			// Remove the request from the list, and free its entry before sending it, because it may be resubmitted right away
+			const auto index = list._first;
+			auto &parked = _parkedRequests[index];
+			const auto entry = parked._entry;
+			list._first = parked._next;
+			if (list._first == kNoParkedRequest)
+			{
+				list._last = kNoParkedRequest;
+			}
+			parked._next = _freeParkedRequest;
+			_freeParkedRequest = index;
+
+			send(entry, IoPriority(priority));
+		}
+	}
+}
+
+auto IoWorker::receiveReady([[maybe_unused]] std::uint32_t wakeUpCount) noexcept -> void
+{
+#if defined(__linux__)
+	// Wait for the connections that have a poll handle. If there are requests in flight on connections without one, we only check
+	// which connections are ready without waiting, because we have to block on one of the other connections afterwards.
+	if (_epoll >= 0)
+	{
+		auto timeout = -1;
+		if (_firstBlocking)
+		{
+			timeout = 0;
+		}
+		else
+		{
+			// Don't wait beyond the next deadline
+			if (_nextDeadline != std::chrono::steady_clock::time_point::max())
+			{
+				const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(_nextDeadline - std::chrono::steady_clock::now());
+				timeout = int(std::clamp<std::chrono::milliseconds::rep>(remaining.count(), 0, std::numeric_limits<int>::max()));
+			}
+
+			// Tell submit() to wake us up using the event, and make sure no request was submitted in the meantime
+			_polling.store(true, std::memory_order_seq_cst);
+			if (_wakeUpCount.load(std::memory_order_seq_cst) != wakeUpCount)
+			{
+				timeout = 0;
+			}
+		}
+
+		std::array<::epoll_event, kMaxReadyConnections> events;
+		const auto readyCount = ::epoll_wait(_epoll, events.data(), int(events.size()), timeout);
+		_polling.store(false, std::memory_order_relaxed);
+
+		// Receive a response from each ready connection. If a connection has more responses ready, epoll_wait() will
+		// report it again right away.
+		for (auto index = 0; index < readyCount; ++index)
+		{
+			if (auto connection = static_cast<ConnectionState *>(events[std::size_t(index)].data.ptr))
+			{
+				receive(*connection);
+			}
+			// Reset the wake-up event
+			else
+			{
+				std::uint64_t count { 0 };
+				static_cast<void>(::read(_wakeUpEvent, &count, sizeof(count)));
+			}
+		}
+	}
+#endif
+
+	// Receive from the connections without a poll handle in turn, blocking until the response arrives. A connection that
+	// is still busy afterwards goes to the back of the list, so that the others get their turn.
+	if (auto connection = _firstBlocking)
+	{
+		receive(*connection);
+		if (connection->_inFlightCount > 0 && connection == _firstBlocking)
+		{
+			removeBlocking(*connection);
+			appendBlocking(*connection);
+		}
+	}
+}
+
+auto IoWorker::release(ConnectionState &connection, InFlightRequest &slot) noexcept -> AbstractIoRequest &
+{
+	auto &request = *slot._request;
+	slot = {};
+	--_inFlightCount;
+	if (--connection._inFlightCount == 0 && !connection._polled)
+	{
+		removeBlocking(connection);
+	}
+	return request;
+}
+
+auto IoWorker::receive(ConnectionState &connection) noexcept -> void
+{
+	// Fails all the requests in flight on the connection
+	const auto failAll = [&](std::error_code error)
+		{
+			for (auto &&slot : connection._inFlight)
+			{
+				if (slot._request)
+				{
+					release(connection, slot).fail(error);
+				}
+			}
+		};
+
+	try
+	{
+		// Receive the header of the next response, and find the matching request
+		const auto requestId = connection._connection->receiveResponseId();
+		const auto match = std::ranges::find_if(connection._inFlight, [&](const InFlightRequest &slot)
+			{
+				return slot._request && slot._requestId == requestId;
+			});
+		if (match != connection._inFlight.end())
+		{
+			// Free the slot before receiving, because the request may be resubmitted as soon as it reports its completion
+			release(connection, *match).receive();
+		}
+		// Skip the responses of requests that have already timed out
+		else if (const auto timedOut = std::ranges::find_if(connection._timedOut, [&](const TimedOutRequest &entry)
+			{
+				return entry._valid && entry._requestId == requestId;
+			});
+			timedOut != connection._timedOut.end())
+		{
+			timedOut->_valid = false;
+			connection._connection->skipResponse();
+		}
+		// A response that does not belong to any request means that the connection has lost track of the requests, so the
+		// requests in flight may never receive their responses. Fail them rather than leaving them in flight forever.
+		else
+		{
+			connection._connection->skipResponse();
+			failAll(CustomError::UnexpectedResponse);
+		}
+	}
+	catch (const std::exception &)
+	{
+		// The connection failed, so none of the requests in flight on it will receive a response. The numbering of the
+		// requests starts over, like after opening the connection.
+		failAll(utils::eh::currentErrorCode());
+		connection._nextRequestId = 0;
+		std::ranges::fill(connection._timedOut, TimedOutRequest {});
+
+		// Stop polling the connection, so that a closed connection is not reported as ready over and over again. It is
+		// polled again once the next request has been sent over it.
+		unpoll(connection);
+	}
+
+	// Fill the slots that became free
+	sendParked(connection);
+}
+
+auto IoWorker::expireRequests(std::chrono::steady_clock::time_point now) noexcept -> void
+{
+	// Find the new earliest deadline while going through the requests
+	_nextDeadline = std::chrono::steady_clock::time_point::max();
+
+	for (auto &&[key, connection] : _connections)
+	{
+		// Fail the requests in flight that timed out, and remember their IDs, so that a late response is not mistaken for
+		// a response that does not belong to any request
+		bool expired = false;
+		for (auto &&slot : connection._inFlight)
+		{
+			if (!slot._request)
+			{
+				continue;
+			}
+			if (slot._deadline > now)
+			{
+				_nextDeadline = std::min(_nextDeadline, slot._deadline);
+				continue;
+			}
+
+			connection._timedOut[connection._nextTimedOut] = { slot._requestId, true };
+			connection._nextTimedOut = (connection._nextTimedOut + 1) % connection._timedOut.size();
+			release(connection, slot).fail(CustomError::Timeout);
+			expired = true;
+		}
+
+		// Fail the parked requests that timed out
+		for (auto &&list : connection._parked)
+		{
+			auto previous = kNoParkedRequest;
+			for (auto index = list._first; index != kNoParkedRequest;)
+			{
+				auto &parked = _parkedRequests[index];
+				const auto next = parked._next;
+				if (parked._entry._deadline > now)
+				{
+					_nextDeadline = std::min(_nextDeadline, parked._entry._deadline);
+					previous = index;
+					index = next;
+					continue;
+				}
+
+				// Remove the request from the list, and free its entry before failing it, because it may be resubmitted right away
+				(previous != kNoParkedRequest ? _parkedRequests[previous]._next : list._first) = next;
+				if (list._last == index)
+				{
+					list._last = previous;
+				}
+				const auto entry = parked._entry;
+				parked._next = _freeParkedRequest;
+				_freeParkedRequest = index;
+				entry._request->fail(CustomError::Timeout);
+				index = next;
+			}
+		}
+
+		// Fill the slots that became free
+		if (expired)
+		{
+			sendParked(connection);
+		}
+	}
+}
+
+auto IoWorker::appendBlocking(ConnectionState &connection) noexcept -> void
+{
+	connection._previousBlocking = _lastBlocking;
+	connection._nextBlocking = nullptr;
+	(_lastBlocking ? _lastBlocking->_nextBlocking : _firstBlocking) = &connection;
+	_lastBlocking = &connection;
+}
+
+auto IoWorker::removeBlocking(ConnectionState &connection) noexcept -> void
+{
+	(connection._previousBlocking ? connection._previousBlocking->_nextBlocking : _firstBlocking) = connection._nextBlocking;
+	(connection._nextBlocking ? connection._nextBlocking->_previousBlocking : _lastBlocking) = connection._previousBlocking;
+	connection._previousBlocking = nullptr;
+	connection._nextBlocking = nullptr;
+}
+
+auto IoWorker::poll([[maybe_unused]] ConnectionState &connection) noexcept -> void
+{
+#if defined(__linux__)
+	if (connection._pollHandle < 0 || _epoll < 0)
+	{
+		return;
+	}
+
+	// If the handle cannot be registered, the connection is received from blocking instead
+	::epoll_event event {};
+	event.events = EPOLLIN;
+	event.data.ptr = &connection;
+	connection._polled = ::epoll_ctl(_epoll, EPOLL_CTL_ADD, connection._pollHandle, &event) == 0;
+#endif
+}
+
+auto IoWorker::unpoll([[maybe_unused]] ConnectionState &connection) noexcept -> void
+{
+#if defined(__linux__)
+	if (connection._polled)
+	{
+		::epoll_ctl(_epoll, EPOLL_CTL_DEL, connection._pollHandle, nullptr);
+		connection._polled = false;
+	}
+#endif
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,310 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "AbstractIoConnection.hpp"
+#include "AbstractIoRequest.hpp"
+#include "BoundedQueue.hpp"
+#include "IoPriority.hpp"
+#include "IoQueueStatistics.hpp"
+#include "ThreadOptions.hpp"
+
+#include <xentara/utils/tools/Unique.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief A thread that executes the I/O requests of the transactions of an I/O component
+///
+/// The transactions submit requests to a lock-free queue, and the worker executes them. This way, only the worker thread
+/// talks to the I/O component, and slow responses do not block the threads of the Xentara scheduler unless they explicitly
+/// wait for a completion.
+///
+/// The worker can send requests over any number of connections, which must be registered using addConnection(). Each
+/// connection can have several requests in flight at the same time, up to its own pipelining depth. Queued requests are sent
+/// back to back, and the responses are matched to the requests using request IDs. Requests for a connection whose pipeline
+/// is full are held back until one of its responses has been received, without holding up the requests for other connections.
+///
+/// Under Linux, the worker waits for the poll handles of all the connections with requests in flight using a single epoll
+/// instance, and only receives responses from connections that are ready. Connections without a poll handle are received from
+/// one after the other, blocking until the response arrives.
+///
+/// Each request can have a deadline. A request that has not received its response by then fails with CustomError::Timeout,
+/// whether it is still waiting to be sent, or already in flight. A response that arrives after the deadline is skipped.
+/// The deadlines of requests sent over connections without a poll handle are only checked between two blocking receives.
+///
+/// Each priority class has its own queue. Control requests are always sent first, and the Normal and Bulk classes share the
+/// remaining capacity by weighted round robin, so that bulk polls cannot hold up the requests of control loops or writes.
+class IoWorker final : private utils::tools::Unique
+{
+public:
+	/// @brief The destructor stops the thread, if it is still running
+	~IoWorker()
+	{
+		stop();
+	}
+
+	/// @brief Registers a connection that requests can be sent over
+	///
+	/// This must only be done while the thread is not running.
+	/// @param connection The connection. The connection must remain valid, and its poll handle must not change, until it
+	/// has been removed using removeConnection().
+	/// @param pipelineDepth The maximum number of requests that can be in flight on the connection at the same time
+	auto addConnection(AbstractIoConnection &connection, std::size_t pipelineDepth) -> void;
+
+	/// @brief Removes a connection registered using addConnection()
+	///
+	/// This must only be done while the thread is not running.
+	auto removeConnection(AbstractIoConnection &connection) noexcept -> void;
+
+	/// @brief Allocates the queue and starts the thread
+	///
+	/// If the thread is already running, it is stopped first. This must only be done while no requests are outstanding.
+	/// The total pipelining depth of the worker is the sum of the pipelining depths of all the registered connections.
+	/// @param queueSize The maximum number of requests that can be queued at the same time
+	/// @param weights The weights used to share the capacity between the Normal and Bulk priority classes
+	/// @param threadOptions The CPU affinity, scheduling policy, and name of the thread
+	/// @throw std::system_error The thread options could not be applied, or the poller could not be created
+	auto start(std::size_t queueSize, const IoPriorityWeights &weights, const ThreadOptions &threadOptions) -> void;
+
+	/// @brief Stops the thread. Any requests still in the queue are executed first.
+	auto stop() noexcept -> void;
+
+	/// @brief Checks whether the thread is running
+	auto running() const noexcept -> bool
+	{
+		return _thread.joinable();
+	}
+
+	/// @brief Submits a request to be executed by the thread
+	/// @param request The request. The request must remain valid until it has been executed.
+	/// @param priority The priority class of the request
+	/// @param statistics The statistics the time the request waits in the queue should be recorded in
+	/// @param deadline The time by which the response must have been received. If it has not, the request fails with
+	/// CustomError::Timeout.
+	/// @throw std::system_error The queue is full
+	/// @throw std::logic_error The connection of the request has not been registered
+	auto submit(AbstractIoRequest &request,
+		IoPriority priority,
+		IoQueueStatistics &statistics,
+		std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max()) -> void;
+
+	/// @brief Adds the statistics of an I/O component served by the thread, so that the CPU time of the thread is recorded in them
+	/// @param statistics The statistics. They must remain valid until removeStatistics() has been called.
+	auto addStatistics(IoQueueStatistics &statistics) -> void;
+
+	/// @brief Removes statistics added using addStatistics()
+	auto removeStatistics(IoQueueStatistics &statistics) noexcept -> void;
+
+private:
+	struct ConnectionState;
+
+	/// @brief A request in one of the queues
+	struct QueuedRequest final
+	{
+		/// @brief The request
+		AbstractIoRequest *_request { nullptr };
+		/// @brief The state of the connection the request is sent over
+		ConnectionState *_connection { nullptr };
+		/// @brief The statistics to record the wait time in
+		IoQueueStatistics *_statistics { nullptr };
+		/// @brief The time the request was submitted
+		std::chrono::steady_clock::time_point _submitTime;
+		/// @brief The time by which the response must have been received
+		std::chrono::steady_clock::time_point _deadline;
+	};
+
+	/// @brief A request that has been sent, but whose response has not been received yet
+	struct InFlightRequest final
+	{
+		/// @brief The request, or nullptr if the slot is free
+		AbstractIoRequest *_request { nullptr };
+		/// @brief The ID the response will carry
+		std::uint32_t _requestId { 0 };
+		/// @brief The time by which the response must have been received
+		std::chrono::steady_clock::time_point _deadline;
+	};
+
+	/// @brief A request that timed out while it was in flight, whose response may still arrive
+	struct TimedOutRequest final
+	{
+		/// @brief The ID the response will carry
+		std::uint32_t _requestId { 0 };
+		/// @brief Whether the entry is in use
+		bool _valid { false };
+	};
+
+	/// @brief A value used instead of an index into _parkedRequests if there is no request
+	static constexpr std::size_t kNoParkedRequest = std::numeric_limits<std::size_t>::max();
+
+	/// @brief A request that was taken from the queues, but could not be sent yet because the pipeline of its connection was full
+	struct ParkedRequest final
+	{
+		/// @brief The request
+		QueuedRequest _entry;
+		/// @brief The index of the next request in the same list
+		std::size_t _next { kNoParkedRequest };
+	};
+
+	/// @brief A list of parked requests, in the order they were parked
+	struct ParkedList final
+	{
+		/// @brief The index of the first request, or kNoParkedRequest if the list is empty
+		std::size_t _first { kNoParkedRequest };
+		/// @brief The index of the last request, or kNoParkedRequest if the list is empty
+		std::size_t _last { kNoParkedRequest };
+	};
+
+	/// @brief The state of a registered connection
+	///
+	/// A connection is *idle* if it has no requests in flight, *busy* if it has requests in flight and free slots, and *full*
+	/// if all its slots are in use. Requests for a full connection are parked, and are sent in order of priority as soon as
+	/// a response frees a slot. Responses are only received from busy and full connections, once their poll handle is ready.
+	struct ConnectionState final
+	{
+		/// @brief The connection
+		AbstractIoConnection *_connection { nullptr };
+		/// @brief The poll handle of the connection, or -1 if it has none
+		int _pollHandle { -1 };
+		/// @brief Whether the poll handle is currently registered with the epoll instance
+		bool _polled { false };
+		/// @brief The slots for the requests in flight. The number of slots is the pipelining depth of the connection.
+		std::vector<InFlightRequest> _inFlight;
+		/// @brief The number of requests in flight
+		std::size_t _inFlightCount { 0 };
+		/// @brief The ID of the next request sent over the connection
+		std::uint32_t _nextRequestId { 0 };
+		/// @brief The most recent requests that timed out while in flight, so that their responses can be skipped if they arrive
+		/// late. There is one entry per slot, and the entries are reused in turn.
+		std::vector<TimedOutRequest> _timedOut;
+		/// @brief The entry of _timedOut to use for the next request that times out
+		std::size_t _nextTimedOut { 0 };
+		/// @brief The parked requests, by priority class
+		std::array<ParkedList, kIoPriorityCount> _parked;
+		/// @brief The previous connection in the list of busy connections that are not polled
+		ConnectionState *_previousBlocking { nullptr };
+		/// @brief The next connection in the list of busy connections that are not polled
+		ConnectionState *_nextBlocking { nullptr };
+	};
+
+	/// @brief The main function of the thread
+	auto run() noexcept -> void;
+
+	/// @brief Takes the next request to send from the queues, according to the priority classes
+	/// @return The request and its priority class, or std::nullopt if all queues are empty
+	auto popNext() noexcept -> std::optional<std::pair<QueuedRequest, IoPriority>>;
+
+	/// @brief Sends a request if its connection has a free slot, and parks it otherwise
+	auto dispatch(const QueuedRequest &entry, IoPriority priority) noexcept -> void;
+
+	/// @brief Sends a request, and records it as in flight. The connection must have a free slot.
+	auto send(const QueuedRequest &entry, IoPriority priority) noexcept -> void;
+
+	/// @brief Sends parked requests of a connection, in order of priority, until its pipeline is full again
+	auto sendParked(ConnectionState &connection) noexcept -> void;
+
+	/// @brief Receives responses from connections that are ready
+	/// @param wakeUpCount The wake-up count at the start of the current iteration of the main loop. The worker does not wait
+	/// for responses if the count has changed, so that newly submitted requests can be sent.
+	auto receiveReady(std::uint32_t wakeUpCount) noexcept -> void;
+
+	/// @brief Receives the next response on a connection
+	auto receive(ConnectionState &connection) noexcept -> void;
+
+	/// @brief Removes a request from its slot
+	/// @return The request
+	auto release(ConnectionState &connection, InFlightRequest &slot) noexcept -> AbstractIoRequest &;
+
+	/// @brief Fails all the requests whose deadline has passed with CustomError::Timeout
+	auto expireRequests(std::chrono::steady_clock::time_point now) noexcept -> void;
+
+	/// @brief Appends a connection to the list of busy connections that are not polled
+	auto appendBlocking(ConnectionState &connection) noexcept -> void;
+
+	/// @brief Removes a connection from the list of busy connections that are not polled
+	auto removeBlocking(ConnectionState &connection) noexcept -> void;
+
+	/// @brief Registers the poll handle of a connection with the epoll instance, if it has one
+	auto poll(ConnectionState &connection) noexcept -> void;
+
+	/// @brief Removes the poll handle of a connection from the epoll instance
+	auto unpoll(ConnectionState &connection) noexcept -> void;
+
+	/// @brief Closes the epoll instance and the wake-up event
+	auto closePoller() noexcept -> void;
+
+	/// @brief Records the CPU time of the thread in the statistics of all the I/O components served by the thread
+	auto recordCpuTime() noexcept -> void;
+
+	/// @brief The number of requests after which the CPU time is recorded, if the thread does not become idle before
+	static constexpr std::size_t kCpuTimeRecordInterval = 64;
+
+	/// @brief The queues of submitted requests, by priority class
+	std::array<BoundedQueue<QueuedRequest>, kIoPriorityCount> _queues;
+
+	/// @brief The weights of the Normal and Bulk priority classes
+	IoPriorityWeights _weights;
+	/// @brief The number of requests the Normal class may still send in the current round. This is only used by the thread.
+	std::size_t _normalCredit { 0 };
+	/// @brief The number of requests the Bulk class may still send in the current round. This is only used by the thread.
+	std::size_t _bulkCredit { 0 };
+
+	/// @brief A counter that is incremented whenever the thread needs to wake up, used with std::atomic::wait()
+	std::atomic<std::uint32_t> _wakeUpCount { 0 };
+	/// @brief Whether the thread should stop
+	std::atomic<bool> _stopRequested { false };
+
+	/// @brief The registered connections. The map itself is only changed while the thread is not running, so that it can
+	/// be used by submit() without locking. The states are only used by the thread.
+	std::unordered_map<AbstractIoConnection *, ConnectionState> _connections;
+	/// @brief The total pipelining depth of all the connections
+	std::size_t _pipelineDepth { 0 };
+	/// @brief The total number of requests in flight. This is only used by the thread.
+	std::size_t _inFlightCount { 0 };
+	/// @brief The earliest deadline of all the requests that are in flight or parked. Requests that have completed since are not
+	/// taken into account, so this may be earlier than the actual earliest deadline. This is only used by the thread.
+	std::chrono::steady_clock::time_point _nextDeadline { std::chrono::steady_clock::time_point::max() };
+	/// @brief The first of the busy connections whose poll handle is not registered, which are received from one after the other,
+	/// in the order they became busy. This is only used by the thread.
+	ConnectionState *_firstBlocking { nullptr };
+	/// @brief The last of the busy connections whose poll handle is not registered. This is only used by the thread.
+	ConnectionState *_lastBlocking { nullptr };
+
+	/// @brief The storage for the parked requests, with room for every request that can be queued
+	std::vector<ParkedRequest> _parkedRequests;
+	/// @brief The index of the first unused entry in _parkedRequests. The unused entries are linked using ParkedRequest::_next.
+	std::size_t _freeParkedRequest { kNoParkedRequest };
+
+	/// @brief The epoll instance used to wait for the connections, or -1 if there is none
+	int _epoll { -1 };
+	/// @brief An event file descriptor used to wake up the thread while it is waiting for connections, or -1 if there is none
+	int _wakeUpEvent { -1 };
+	/// @brief Whether the thread is waiting for connections, and needs to be woken up using _wakeUpEvent
+	std::atomic<bool> _polling { false };
+
+	/// @brief A mutex protecting the list of statistics to record the CPU time in
+	///
+	/// This is only contended while I/O components are added or removed.
+	std::mutex _statisticsMutex;
+	/// @brief The statistics of all the I/O components served by the thread, to record the CPU time in
+	std::vector<IoQueueStatistics *> _statistics;
+	/// @brief The number of requests sent since the CPU time was last recorded. This is only used by the thread.
+	std::size_t _sendsSinceCpuTimeRecord { 0 };
+
+	/// @brief The thread
+	std::thread _thread;
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
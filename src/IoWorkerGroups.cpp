@@ -0,0 +1,83 @@
+// Copyright (c) embedded ocean GmbH
+#include "IoWorkerGroups.hpp"
+
+#include <stdexcept>
+
+namespace xentara::plugins::templateDriver
+{
+
+auto IoWorkerGroups::acquire(std::size_t group,
+	std::size_t requestCount,
+	std::span<AbstractIoConnection *const> connections,
+	std::size_t pipelineDepth,
+	const IoPriorityWeights &weights,
+	const ThreadOptions &threadOptions,
+	IoQueueStatistics &statistics) -> IoWorker &
+{
+	// A connection without a poll handle would block the thread of the group while waiting for its responses
+	for (auto &&connection : connections)
+	{
+		if (connection->pollHandle() < 0)
+		{
+			throw std::invalid_argument("I/O components whose connections have no poll handle cannot share an I/O worker group");
+		}
+	}
+
+	std::scoped_lock lock { _mutex };
+
+	auto &entry = _groups[group];
+	if (entry._componentCount == 0)
+	{
+		entry._weights = weights;
+		entry._threadOptions = threadOptions;
+	}
+	entry._requestCount += requestCount;
+	++entry._componentCount;
+
+	// Connections can only be registered while the worker is stopped
+	entry._worker.stop();
+	for (auto &&connection : connections)
+	{
+		entry._worker.addConnection(*connection, pipelineDepth);
+	}
+
+	// (Re)start the worker with a queue large enough for all the I/O components
+	entry._worker.start(entry._requestCount, entry._weights, entry._threadOptions);
+	entry._worker.addStatistics(statistics);
+
+	return entry._worker;
+}
+
+auto IoWorkerGroups::release(std::size_t group,
+	std::size_t requestCount,
+	std::span<AbstractIoConnection *const> connections,
+	IoQueueStatistics &statistics) -> void
+{
+	std::scoped_lock lock { _mutex };
+
+	const auto entry = _groups.find(group);
+	if (entry == _groups.end())
+	{
+		return;
+	}
+
+	auto &worker = entry->second._worker;
+	worker.removeStatistics(statistics);
+	entry->second._requestCount -= requestCount;
+	if (--entry->second._componentCount == 0)
+	{
+		// Stop the worker and remove the group
+		_groups.erase(entry);
+		return;
+	}
+
+	// Restart the worker without the connections of the I/O component
+	worker.stop();
+	for (auto &&connection : connections)
+	{
+		worker.removeConnection(*connection);
+	}
+	worker.start(entry->second._requestCount, entry->second._weights, entry->second._threadOptions);
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
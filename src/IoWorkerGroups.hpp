@@ -0,0 +1,90 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "IoPriority.hpp"
+#include "IoWorker.hpp"
+#include "ThreadOptions.hpp"
+
+#include <xentara/utils/tools/Unique.hpp>
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <span>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief I/O workers that are shared between several I/O components
+///
+/// Each group has a single worker thread that executes the requests of all the I/O components assigned to it. This allows
+/// a large number of I/O components to be served by a small number of threads. The requests of each I/O component are still
+/// executed one after the other, in the order they were submitted.
+class IoWorkerGroups final : private utils::tools::Unique
+{
+public:
+	/// @brief Adds an I/O component to a group, starting the worker if necessary
+	///
+	/// If the worker is already running, it is restarted with a larger queue. This must only be done while the I/O
+	/// components are being prepared, and no requests are outstanding.
+	/// @param group The number of the group
+	/// @param requestCount The maximum number of requests the I/O component can have outstanding at the same time
+	/// @param connections The connections of the I/O component. They are registered with the worker, and must remain valid until
+	/// release() has been called. All the connections must have a poll handle, because a connection that has to be received
+	/// from blocking would hold up all the other I/O components in the group, including their Control requests.
+	/// @param pipelineDepth The maximum number of requests that can be in flight on each of the connections at the same time.
+	/// Each connection keeps its own limit, so the pipelining depth of the group is the sum of the depths of all the connections
+	/// of all its I/O components.
+	/// @param weights The weights of the priority classes. The group uses the weights of the first I/O component added to it.
+	/// @param threadOptions The options for the worker thread. The group uses the options of the first I/O component added to it.
+	/// @param statistics The statistics of the I/O component. The CPU time of the worker thread is recorded in the statistics of
+	/// all the I/O components in the group.
+	/// @return The worker of the group. The worker remains valid until release() has been called for all the I/O
+	/// components in the group.
+	/// @throw std::invalid_argument One of the connections has no poll handle
+	/// @throw std::system_error The thread options could not be applied
+	auto acquire(std::size_t group,
+		std::size_t requestCount,
+		std::span<AbstractIoConnection *const> connections,
+		std::size_t pipelineDepth,
+		const IoPriorityWeights &weights,
+		const ThreadOptions &threadOptions,
+		IoQueueStatistics &statistics) -> IoWorker &;
+
+	/// @brief Removes an I/O component from a group, and stops the worker if it was the last one
+	///
+	/// If other I/O components remain in the group, the worker is restarted without the connections of the I/O component.
+	/// This must only be done while the I/O components are being cleaned up.
+	/// @param group The number of the group
+	/// @param requestCount The request count passed to acquire()
+	/// @param connections The connections passed to acquire()
+	/// @param statistics The statistics passed to acquire()
+	/// @throw std::system_error The worker could not be restarted
+	auto release(std::size_t group,
+		std::size_t requestCount,
+		std::span<AbstractIoConnection *const> connections,
+		IoQueueStatistics &statistics) -> void;
+
+private:
+	/// @brief A group
+	struct Group final
+	{
+		/// @brief The worker
+		IoWorker _worker;
+		/// @brief The total request count of all the I/O components in the group
+		std::size_t _requestCount { 0 };
+		/// @brief The number of I/O components in the group
+		std::size_t _componentCount { 0 };
+		/// @brief The weights of the priority classes
+		IoPriorityWeights _weights;
+		/// @brief The options for the worker thread
+		ThreadOptions _threadOptions;
+	};
+
+	/// @brief A mutex protecting the groups. This is only used while the I/O components are prepared and cleaned up.
+	std::mutex _mutex;
+	/// @brief The groups by number. A map is used because the addresses of the workers must not change.
+	std::map<std::size_t, Group> _groups;
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
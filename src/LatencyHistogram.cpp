@@ -0,0 +1,60 @@
+// Copyright (c) embedded ocean GmbH
+#include "LatencyHistogram.hpp"
+
+namespace xentara::plugins::templateDriver
+{
+
+auto LatencyHistogram::reset() noexcept -> void
+{
+	for (auto &&bucket : _buckets)
+	{
+		bucket.store(0, std::memory_order_relaxed);
+	}
+	_sampleCount.store(0, std::memory_order_relaxed);
+	_max.store(0, std::memory_order_relaxed);
+	for (auto &&statistic : _statistics)
+	{
+		statistic.store(0.0, std::memory_order_relaxed);
+	}
+}
+
+auto LatencyHistogram::updatePercentiles() noexcept -> void
+{
+	// Take a snapshot of the buckets. Concurrent samples may make the snapshot slightly inconsistent, which is acceptable
+	// for statistics.
+	std::uint64_t total { 0 };
+	for (auto &&bucket : _buckets)
+	{
+		total += bucket.load(std::memory_order_relaxed);
+	}
+	if (total == 0)
+	{
+		return;
+	}
+
+	// The percentiles to calculate, in ascending order, as fractions of 1000
+	struct Percentile final
+	{
+		Statistic _statistic;
+		std::uint64_t _perMille;
+	};
+	constexpr std::array kPercentiles { Percentile { Statistic::P50, 500 }, Percentile { Statistic::P99, 990 }, Percentile { Statistic::P999, 999 } };
+
+	// Walk through the buckets once, and report the upper bound of the bucket that contains each percentile
+	std::uint64_t count { 0 };
+	auto percentile = kPercentiles.begin();
+	for (std::size_t index = 0; index < kBucketCount && percentile != kPercentiles.end(); ++index)
+	{
+		count += _buckets[index].load(std::memory_order_relaxed);
+		while (percentile != kPercentiles.end() && count * 1000 >= total * percentile->_perMille)
+		{
+			mutableStatistic(percentile->_statistic).store(double(bucketUpperBound(index)) * 1e-6, std::memory_order_relaxed);
+			++percentile;
+		}
+	}
+
+	// Refresh the maximum as well, in case concurrent samples stored it out of order
+	mutableStatistic(Statistic::Max).store(double(_max.load(std::memory_order_relaxed)) * 1e-6, std::memory_order_relaxed);
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,139 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <xentara/utils/tools/Unique.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief A lock-free histogram of durations with logarithmic buckets
+///
+/// The histogram uses the same bucket layout as an HDR histogram: durations are recorded with microsecond resolution,
+/// and each power of two is divided into the same number of linear sub-buckets. This keeps the relative error below
+/// about 6% across the entire range from one microsecond to more than an hour, using a fixed amount of memory.
+///
+/// Recording a duration only increments a few atomic counters, so it can be done from any thread without locks or
+/// allocations. The percentiles are recalculated from the buckets every few samples, and are available as atomic values
+/// that can be used in Xentara read handles.
+class LatencyHistogram final : private utils::tools::Unique
+{
+public:
+	/// @brief The statistics that are calculated from the histogram
+	enum class Statistic
+	{
+		/// @brief The median
+		P50,
+		/// @brief The 99th percentile
+		P99,
+		/// @brief The 99.9th percentile
+		P999,
+		/// @brief The maximum
+		Max
+	};
+
+	/// @brief Records a duration
+	/// @param duration The duration. Negative durations are recorded as zero.
+	auto record(std::chrono::nanoseconds duration) noexcept -> void
+	{
+		const auto microseconds = std::uint64_t(std::clamp<std::chrono::microseconds::rep>(
+			std::chrono::duration_cast<std::chrono::microseconds>(duration).count(), 0, kMaxValue));
+
+		_buckets[bucketIndex(microseconds)].fetch_add(1, std::memory_order_relaxed);
+
+		// Update the maximum right away, since it is cheap
+		if (auto max = _max.load(std::memory_order_relaxed); microseconds > max)
+		{
+			while (microseconds > max && !_max.compare_exchange_weak(max, microseconds, std::memory_order_relaxed))
+			{
+			}
+			mutableStatistic(Statistic::Max).store(double(_max.load(std::memory_order_relaxed)) * 1e-6, std::memory_order_relaxed);
+		}
+
+		// Recalculate the percentiles every few samples
+		if ((_sampleCount.fetch_add(1, std::memory_order_relaxed) + 1) % kUpdateInterval == 0)
+		{
+			updatePercentiles();
+		}
+	}
+
+	/// @brief Clears the histogram
+	///
+	/// Samples that are recorded concurrently may or may not be included in the new histogram.
+	auto reset() noexcept -> void;
+
+	/// @brief Gets a statistic, in seconds
+	auto statistic(Statistic statistic) const noexcept -> const std::atomic<double> &
+	{
+		return _statistics[std::size_t(statistic)];
+	}
+
+private:
+	/// @brief Gets a statistic, in seconds, for writing
+	auto mutableStatistic(Statistic statistic) noexcept -> std::atomic<double> &
+	{
+		return _statistics[std::size_t(statistic)];
+	}
+
+	/// @brief Recalculates the percentiles from the buckets
+	auto updatePercentiles() noexcept -> void;
+
+	/// @brief Gets the index of the bucket a value belongs to
+	static constexpr auto bucketIndex(std::uint64_t value) noexcept -> std::size_t
+	{
+		// Small values have a bucket each
+		if (value < 2 * kHalfSubBucketCount)
+		{
+			return std::size_t(value);
+		}
+
+		// Larger values are shifted so that they fall into the upper half of the sub-buckets
+		const auto shift = std::size_t(std::bit_width(value)) - kSubBucketBits;
+		return shift * kHalfSubBucketCount + std::size_t(value >> shift);
+	}
+
+	/// @brief Gets the largest value that falls into a bucket
+	static constexpr auto bucketUpperBound(std::size_t index) noexcept -> std::uint64_t
+	{
+		if (index < 2 * kHalfSubBucketCount)
+		{
+			return index;
+		}
+
+		const auto shift = index / kHalfSubBucketCount - 1;
+		const auto subBucket = index - shift * kHalfSubBucketCount;
+		return ((std::uint64_t(subBucket) + 1) << shift) - 1;
+	}
+
+	/// @brief The number of bits used for the sub-buckets of each power of two
+	static constexpr std::size_t kSubBucketBits = 5;
+	/// @brief Half the number of sub-buckets. Only the upper half is used for values above the first power of two.
+	static constexpr std::size_t kHalfSubBucketCount = std::size_t(1) << (kSubBucketBits - 1);
+	/// @brief The number of bits of the largest value that can be recorded
+	static constexpr std::size_t kMaxValueBits = 32;
+	/// @brief The largest value that can be recorded, in microseconds. Larger values are clamped to this.
+	static constexpr std::chrono::microseconds::rep kMaxValue = (std::chrono::microseconds::rep(1) << kMaxValueBits) - 1;
+	/// @brief The number of buckets. The values with the most bits are shifted by kMaxValueBits - kSubBucketBits.
+	static constexpr std::size_t kBucketCount = (kMaxValueBits - kSubBucketBits + 2) * kHalfSubBucketCount;
+	/// @brief The number of samples after which the percentiles are recalculated
+	static constexpr std::uint64_t kUpdateInterval = 16;
+
+	/// @brief The number of samples in each bucket
+	std::array<std::atomic<std::uint64_t>, kBucketCount> _buckets {};
+	/// @brief The total number of samples recorded
+	std::atomic<std::uint64_t> _sampleCount { 0 };
+	/// @brief The largest value recorded, in microseconds
+	std::atomic<std::uint64_t> _max { 0 };
+
+	/// @brief The statistics, in seconds
+	std::array<std::atomic<double>, 4> _statistics {};
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
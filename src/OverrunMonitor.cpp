@@ -0,0 +1,107 @@
+// Copyright (c) embedded ocean GmbH
+#include "OverrunMonitor.hpp"
+
+namespace xentara::plugins::templateDriver
+{
+
+auto OverrunMonitor::forEachAttribute(const model::ForEachAttributeFunction &function) const -> bool
+{
+	// Handle all the attributes we support
+	return
+		function(_countAttribute) ||
+		function(_consecutiveAttribute);
+}
+
+auto OverrunMonitor::forEachEvent(const model::ForEachEventFunction &function, std::shared_ptr<void> parent) -> bool
+{
+	// Handle all the events we support
+	return function(_eventRole.get(), std::shared_ptr<process::Event>(parent, &_overrunEvent));
+}
+
+auto OverrunMonitor::makeReadHandle(const model::Attribute &attribute) const noexcept -> std::optional<data::ReadHandle>
+{
+	// Try each readable attribute
+	if (attribute == _countAttribute)
+	{
+		return data::ReadHandle { _overrunCount };
+	}
+	else if (attribute == _consecutiveAttribute)
+	{
+		return data::ReadHandle { _consecutiveOverruns };
+	}
+
+	return std::nullopt;
+}
+
+auto OverrunMonitor::startCycle(std::chrono::system_clock::time_point scheduledTime) noexcept -> void
+{
+	// Infer the period from the scheduled start times. The shortest interval is used, so that cycles skipped by the scheduler
+	// do not lengthen the period.
+	if (_lastScheduledTime && scheduledTime > *_lastScheduledTime)
+	{
+		const auto interval = std::chrono::duration_cast<std::chrono::nanoseconds>(scheduledTime - *_lastScheduledTime);
+		if (!_inferredPeriod || interval < *_inferredPeriod)
+		{
+			_inferredPeriod = interval;
+		}
+	}
+	_lastScheduledTime = scheduledTime;
+	_overrunCounted = false;
+
+	// Determine the deadline. If the period is not known yet, the cycle is not monitored.
+	const auto period = _period ? _period : _inferredPeriod;
+	if (period)
+	{
+		_deadline = scheduledTime + std::chrono::duration_cast<std::chrono::system_clock::duration>(*period);
+	}
+	else
+	{
+		_deadline = std::nullopt;
+	}
+}
+
+auto OverrunMonitor::check(PendingEventList &eventsToRaise) noexcept -> void
+{
+	// Only count the overrun once
+	if (!_deadline || _overrunCounted || std::chrono::system_clock::now() <= *_deadline)
+	{
+		return;
+	}
+
+	countOverrun();
+	eventsToRaise.push_back(_overrunEvent);
+}
+
+auto OverrunMonitor::finishCycle() -> void
+{
+	if (!_deadline)
+	{
+		return;
+	}
+
+	// Check again, because the task may have overrun after its data was committed. The event cannot be raised together
+	// with the data any more, so raise it on its own.
+	if (!_overrunCounted && std::chrono::system_clock::now() > *_deadline)
+	{
+		countOverrun();
+		_overrunEvent.raise();
+	}
+
+	// A cycle that finished in time ends the run of consecutive overruns
+	if (!_overrunCounted)
+	{
+		_consecutiveOverruns.store(0, std::memory_order_relaxed);
+	}
+
+	_deadline = std::nullopt;
+}
+
+auto OverrunMonitor::countOverrun() noexcept -> void
+{
+	// The counters are only written by the thread executing the task, so they need not be incremented atomically.
+	_overrunCount.store(_overrunCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	_consecutiveOverruns.store(_consecutiveOverruns.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	_overrunCounted = true;
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,131 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "Types.hpp"
+
+#include <xentara/data/ReadHandle.hpp>
+#include <xentara/model/Attribute.hpp>
+#include <xentara/model/ForEachAttributeFunction.hpp>
+#include <xentara/model/ForEachEventFunction.hpp>
+#include <xentara/process/Event.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief Detects overruns of a task
+///
+/// A task overruns if it has not finished by the time its next cycle is scheduled to start. The period of the task is either
+/// configured, or inferred from the scheduled start times of the cycles. The number of overruns and the number of consecutive
+/// overruns are published as attributes, and an event is raised for every overrun, so that supervisory logic can shed load
+/// before the scheduler starts slipping.
+class OverrunMonitor final
+{
+public:
+	/// @brief Constructor
+	/// @param countAttribute The attribute containing the number of overruns
+	/// @param consecutiveAttribute The attribute containing the number of consecutive overruns
+	/// @param eventRole The role of the event raised for each overrun
+	/// @param direction The I/O direction of the event
+	OverrunMonitor(const model::Attribute &countAttribute,
+		const model::Attribute &consecutiveAttribute,
+		const process::Event::Role &eventRole,
+		io::Direction direction) :
+		_countAttribute(countAttribute),
+		_consecutiveAttribute(consecutiveAttribute),
+		_eventRole(eventRole),
+		_overrunEvent(direction)
+	{
+	}
+
+	/// @brief Sets the period of the task, instead of inferring it from the scheduled start times
+	auto setPeriod(std::chrono::nanoseconds period) noexcept -> void
+	{
+		_period = period;
+	}
+
+	/// @brief Iterates over all the attributes that belong to the monitor.
+	/// @param function The function that should be called for each attribute
+	/// @return The return value of the last function call
+	auto forEachAttribute(const model::ForEachAttributeFunction &function) const -> bool;
+
+	/// @brief Iterates over all the events that belong to the monitor.
+	/// @param function The function that should be called for each events
+	/// @param parent
+	/// @parblock
+	/// A shared pointer to the containing object.
+	/// 
+	/// The pointer is used in the aliasing constructor of std::shared_ptr when constructing the event pointers,
+	/// so that they will share ownership information with pointers to the parent object.
+	/// @endparblock
+	/// @return The return value of the last function call
+	auto forEachEvent(const model::ForEachEventFunction &function, std::shared_ptr<void> parent) -> bool;
+
+	/// @brief Creates a read-handle for an attribute that belongs to the monitor.
+	/// @param attribute The attribute to create the handle for
+	/// @return A read handle for the attribute, or std::nullopt if the attribute is unknown
+	auto makeReadHandle(const model::Attribute &attribute) const noexcept -> std::optional<data::ReadHandle>;
+
+	/// @brief Adds the number of events that check() can raise
+	/// @param eventCount A variable that counts the total number of events than can be raised for a single update.
+	auto attach(std::size_t &eventCount) -> void
+	{
+		eventCount += 1;
+	}
+
+	/// @brief Starts monitoring a cycle of the task
+	/// @param scheduledTime The time the cycle was scheduled to start
+	auto startCycle(std::chrono::system_clock::time_point scheduledTime) noexcept -> void;
+
+	/// @brief Checks whether the current cycle has overrun, and adds the overrun event to a list if it has
+	///
+	/// This must be called just before the data of the task is committed, so that the event is raised together with the data.
+	/// It does nothing outside of a cycle, or if the overrun of the current cycle was already counted.
+	/// @param eventsToRaise The overrun event will be added to this list, if the cycle overran.
+	auto check(PendingEventList &eventsToRaise) noexcept -> void;
+
+	/// @brief Finishes monitoring a cycle of the task
+	///
+	/// The cycle is checked again, because the task may still overrun after committing its data. An overrun that was not
+	/// detected by check() is counted, and the overrun event is raised on its own, because the data has already been committed.
+	auto finishCycle() -> void;
+
+private:
+	/// @brief Counts an overrun of the current cycle
+	auto countOverrun() noexcept -> void;
+
+	/// @brief The attribute containing the number of overruns
+	std::reference_wrapper<const model::Attribute> _countAttribute;
+	/// @brief The attribute containing the number of consecutive overruns
+	std::reference_wrapper<const model::Attribute> _consecutiveAttribute;
+	/// @brief The role of the overrun event
+	std::reference_wrapper<const process::Event::Role> _eventRole;
+
+	/// @brief The configured period of the task, if any
+	std::optional<std::chrono::nanoseconds> _period;
+	/// @brief The shortest time seen between the scheduled start times of two cycles, which is used if no period was configured
+	std::optional<std::chrono::nanoseconds> _inferredPeriod;
+	/// @brief The scheduled start time of the last cycle, if any
+	std::optional<std::chrono::system_clock::time_point> _lastScheduledTime;
+	/// @brief The time by which the current cycle must finish, or std::nullopt if no cycle is being monitored
+	std::optional<std::chrono::system_clock::time_point> _deadline;
+	/// @brief Whether an overrun was already counted for the current cycle
+	bool _overrunCounted { false };
+
+	/// @brief The number of overruns
+	std::atomic<std::uint64_t> _overrunCount { 0 };
+	/// @brief The number of consecutive overruns, up to and including the last cycle
+	std::atomic<std::uint64_t> _consecutiveOverruns { 0 };
+
+	/// @brief A Xentara event that is raised when the task overran
+	process::Event _overrunEvent;
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,122 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "AbstractImmediateWriter.hpp"
+
+#include <xentara/utils/tools/Unique.hpp>
+
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief A thread-safe, lock-free set of outputs that have pending values.
+///
+/// The set is a bitmap with one bit per output. Outputs mark themselves when a value is scheduled, so that the I/O transaction
+/// only needs to visit the outputs that actually have pending values, instead of checking all of them.
+class PendingOutputSet final : private utils::tools::Unique
+{
+	/// @brief The type of a single word of the bitmap
+	using Word = std::uint64_t;
+	/// @brief The number of bits in a word
+	static constexpr std::size_t kWordBits = sizeof(Word) * 8;
+
+public:
+	/// @brief A handle used to mark a single output as pending
+	class Marker final
+	{
+	public:
+		/// @brief The default constructor creates a marker that does nothing
+		Marker() noexcept = default;
+
+		/// @brief Marks the output as pending.
+		///
+		/// This must be called *after* the value has been placed in the output's queue, so that the I/O transaction finds the
+		/// value when it sees the mark. If the output must be written immediately, a write of the value is started instead, but
+		/// this function does not wait for it to complete. Such outputs are not marked in the set, so that all their values
+		/// are written by the immediate writer, one after the other, and an older value cannot overtake a newer one.
+		auto mark() const noexcept -> void
+		{
+			if (_immediateWriter)
+			{
+				_immediateWriter->writeImmediately();
+			}
+			else if (_word)
+			{
+				_word->fetch_or(_bit, std::memory_order_release);
+			}
+		}
+
+	private:
+		/// @brief This constructor is used by PendingOutputSet
+		Marker(std::atomic<Word> &word, Word bit, AbstractImmediateWriter *immediateWriter) noexcept :
+			_word(&word), _bit(bit), _immediateWriter(immediateWriter)
+		{
+		}
+
+		/// @brief The word containing the bit for the output, or nullptr for a default constructed marker
+		std::atomic<Word> *_word { nullptr };
+		/// @brief The bit for the output
+		Word _bit { 0 };
+		/// @brief The object that writes the output immediately, or nullptr to wait for the next write cycle
+		AbstractImmediateWriter *_immediateWriter { nullptr };
+
+		friend class PendingOutputSet;
+	};
+
+	/// @brief Allocates the bitmap for a number of outputs, and clears it.
+	/// @param size The number of outputs
+	auto reset(std::size_t size) -> void
+	{
+		_wordCount = (size + kWordBits - 1) / kWordBits;
+		_words = std::make_unique<std::atomic<Word>[]>(_wordCount);
+	}
+
+	/// @brief Gets a marker for an output
+	/// @param index The index of the output. This must be less than the size passed to reset().
+	/// @param immediateWriter The object that should write the output as soon as it is marked, or nullptr if the output
+	/// should be written in the next write cycle.
+	auto marker(std::size_t index, AbstractImmediateWriter *immediateWriter = nullptr) noexcept -> Marker
+	{
+		return { _words[index / kWordBits], Word(1) << (index % kWordBits), immediateWriter };
+	}
+
+	/// @brief Removes all outputs from the set, and calls a function for each of them.
+	///
+	/// The outputs are visited in order of their index. Any output marked while this function is running is either visited,
+	/// or left in the set for the next call.
+	/// @param function The function to call. It is passed the index of the output.
+	template <std::invocable<std::size_t> Function>
+	auto takeAll(Function &&function) -> void
+	{
+		for (std::size_t wordIndex = 0; wordIndex < _wordCount; ++wordIndex)
+		{
+			auto &word = _words[wordIndex];
+
+			// Check the word before modifying it, so we do not have to write to words without pending outputs
+			if (word.load(std::memory_order_relaxed) == 0)
+			{
+				continue;
+			}
+
+			// Take all the bits, and visit each one
+			for (auto bits = word.exchange(0, std::memory_order_acq_rel); bits != 0; bits &= bits - 1)
+			{
+				function(wordIndex * kWordBits + std::size_t(std::countr_zero(bits)));
+			}
+		}
+	}
+
+private:
+	/// @brief The words of the bitmap
+	std::unique_ptr<std::atomic<Word>[]> _words;
+	/// @brief The number of words in the bitmap
+	std::size_t _wordCount { 0 };
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -59,7 +59,7 @@ auto PerValueReadState<DataType>::update(
 	std::chrono::system_clock::time_point timeStamp,
 	const utils::eh::expected<DataType, std::error_code> &valueOrError,
 	const CommonReadState::Changes &commonChanges,
-	PendingEventList &eventsToRaise) -> void
+	PendingEventList &eventsToRaise) -> bool
 {
 	// Get the correct array entry
 	auto &state = writeSentinel[_stateHandle];
@@ -81,6 +81,33 @@ auto PerValueReadState<DataType>::update(
 	{
 		eventsToRaise.push_back(_changedEvent);
 	}
+
+	return changed;
+}
+
+template <std::regular DataType>
+auto PerValueReadState<DataType>::storeValue(WriteSentinel &writeSentinel, const DataType &value) -> const DataType &
+{
+	// Get the correct array entry
+	auto &state = writeSentinel[_stateHandle];
+	const auto &oldState = writeSentinel.oldValues()[_stateHandle];
+
+	// Set the value, and keep the old change time. We always need to write the change time, because memory resources use swap-in.
+	state._value = value;
+	state._changeTime = oldState._changeTime;
+
+	return oldState._value;
+}
+
+template <std::regular DataType>
+auto PerValueReadState<DataType>::markChanged(
+	WriteSentinel &writeSentinel, std::chrono::system_clock::time_point timeStamp, PendingEventList &eventsToRaise) -> void
+{
+	// Update the change time
+	writeSentinel[_stateHandle]._changeTime = timeStamp;
+
+	// Cause the correct events to be raised
+	eventsToRaise.push_back(_changedEvent);
 }
 
 /// @class xentara::plugins::templateDriver::PerValueReadState
@@ -76,11 +76,28 @@ public:
 	/// @param eventsToRaise Any events that need to be raised as a result of the update will be added to this
 	/// list. The events will not be raised directly, because the write sentinel needs to be commited first,
 	/// which is done by the caller.
+	/// @return Returns true if the value changed, or false if it did not
 	auto update(WriteSentinel &writeSentinel,
 		std::chrono::system_clock::time_point timeStamp,
 		const utils::eh::expected<DataType, std::error_code> &valueOrError,
 		const CommonReadState::Changes &commonChanges,
-		PendingEventList &eventsToRaise) -> void;
+		PendingEventList &eventsToRaise) -> bool;
+
+	/// @brief Stores a new value without marking it as changed
+	///
+	/// This function is used together with markChanged() to update many values at once. The caller stores all the values first,
+	/// then detects which values have changed by comparing them with the old values returned by this function, and then
+	/// calls markChanged() only for the values that changed.
+	/// @param writeSentinel A write sentinel for the data block the data is stored in
+	/// @param value The new value
+	/// @return The previous value
+	auto storeValue(WriteSentinel &writeSentinel, const DataType &value) -> const DataType &;
+
+	/// @brief Marks a value stored using storeValue() as changed
+	/// @param writeSentinel A write sentinel for the data block the data is stored in
+	/// @param timeStamp The update time stamp
+	/// @param eventsToRaise The changed event will be added to this list.
+	auto markChanged(WriteSentinel &writeSentinel, std::chrono::system_clock::time_point timeStamp, PendingEventList &eventsToRaise) -> void;
 
 private:
 	/// @brief This structure is used to represent the state inside the memory block
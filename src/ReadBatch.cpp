@@ -0,0 +1,249 @@
+// Copyright (c) embedded ocean GmbH
+#include "ReadBatch.hpp"
+
+#include "ValueCodec.hpp"
+
+#include <xentara/memory/WriteSentinel.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+namespace xentara::plugins::templateDriver
+{
+
+template <typename ValueType>
+auto ReadBatch<ValueType>::prepare(const ReadCommand &command) -> void
+{
+	for (auto &&entry : _entries)
+	{
+		// Make sure the value is actually read by the command
+		if (entry._address < command.address() ||
+			entry._address + entry._descriptor._size > command.address() + command.size()) [[unlikely]]
+		{
+			throw std::logic_error("internal error: read command does not cover the address of an input");
+		}
+
+		// Compute the offset of the value within the payload
+		entry._descriptor._offset = std::size_t(entry._address - command.address());
+	}
+
+	// Sort the entries by offset, so that values at adjacent addresses are next to each other
+	std::ranges::stable_sort(_entries, {}, [](const Entry &entry) { return entry._descriptor._offset; });
+
+	// Build the runs if the values are decoded using the kernels
+	if constexpr (kUsesDecodeKernels)
+	{
+		prepareRuns();
+	}
+}
+
+template <typename ValueType>
+auto ReadBatch<ValueType>::prepareRuns() -> void
+{
+	_runs.clear();
+	for (std::size_t index = 0; index < _entries.size(); ++index)
+	{
+		const auto &descriptor = _entries[index]._descriptor;
+
+		// Append the value to the last run if it directly follows it and has the same format
+		if (!_runs.empty())
+		{
+			auto &run = _runs.back();
+			if (run._shuffle.elementSize() == descriptor._size &&
+				run._shuffle.byteOrder() == descriptor._byteOrder &&
+				run._offset + run._count * descriptor._size == descriptor._offset)
+			{
+				++run._count;
+				continue;
+			}
+		}
+
+		// Start a new run
+		_runs.push_back({ index, 1, descriptor._offset, kernels::ByteShuffle(descriptor._size, descriptor._byteOrder) });
+	}
+
+	// Allocate the buffers up front, so that no memory needs to be allocated during the update
+	_values.resize(_entries.size());
+	_oldValues.resize(_entries.size());
+	_changes.resize((_entries.size() + 63) / 64);
+	std::size_t widenBufferSize = 0;
+	for (auto &&run : _runs)
+	{
+		if (run._shuffle.elementSize() != sizeof(ValueType))
+		{
+			run._widenOffset = widenBufferSize;
+			widenBufferSize += run._count * run._shuffle.elementSize();
+		}
+	}
+	_widenBuffer.resize(widenBufferSize);
+}
+
+template <typename ValueType>
+auto ReadBatch<ValueType>::decodeRuns(std::span<const std::byte> data, std::size_t first, std::size_t last) -> void
+{
+	if constexpr (kUsesDecodeKernels)
+	{
+		// Find the run containing the first entry
+		auto run = std::ranges::upper_bound(_runs, first, {}, &Run::_firstEntry);
+		if (run != _runs.begin())
+		{
+			--run;
+		}
+
+		// Decode the part of each run that lies within the range
+		for (; run != _runs.end() && run->_firstEntry < last; ++run)
+		{
+			const auto begin = std::max(first, run->_firstEntry);
+			const auto end = std::min(last, run->_firstEntry + run->_count);
+			const auto elementSize = run->_shuffle.elementSize();
+			const auto skipped = (begin - run->_firstEntry) * elementSize;
+			const auto source = data.subspan(run->_offset + skipped, (end - begin) * elementSize);
+			const auto values = _values.data() + begin;
+
+			// Values that have the full size can be converted directly into the value array
+			if (elementSize == sizeof(ValueType))
+			{
+				kernels::toNativeByteOrder(source, reinterpret_cast<std::byte *>(values), run->_shuffle);
+			}
+			// Smaller integers must be widened after the conversion
+			else if constexpr (sizeof(ValueType) > 1 && utils::tools::Integral<ValueType>)
+			{
+				const auto widenBuffer = _widenBuffer.data() + run->_widenOffset + skipped;
+				kernels::toNativeByteOrder(source, widenBuffer, run->_shuffle);
+				kernels::widen(widenBuffer, elementSize, values, end - begin);
+			}
+			else [[unlikely]]
+			{
+				throw std::logic_error("internal error: invalid value size in read batch");
+			}
+		}
+	}
+}
+
+template <typename ValueType>
+auto ReadBatch<ValueType>::updateDecodedValues(WriteSentinel &writeSentinel,
+	std::chrono::system_clock::time_point timeStamp,
+	const CommonReadState::Changes &commonChanges,
+	std::size_t first,
+	std::size_t last,
+	PendingEventList &eventsToRaise) -> std::size_t
+{
+	if constexpr (kUsesDecodeKernels)
+	{
+		// Store all the values, and collect the old values
+		for (auto index = first; index < last; ++index)
+		{
+			_oldValues[index] = _entries[index]._state.get().storeValue(writeSentinel, _values[index]);
+		}
+
+		// If the common read state changed, all the values count as changed
+		if (commonChanges)
+		{
+			for (auto index = first; index < last; ++index)
+			{
+				_entries[index]._state.get().markChanged(writeSentinel, timeStamp, eventsToRaise);
+			}
+			return last - first;
+		}
+
+		// Find the values that changed. The range starts at a word boundary, so it does not share any words with other ranges.
+		const auto firstWord = first / 64;
+		const auto lastWord = (last + 63) / 64;
+		std::fill(_changes.begin() + firstWord, _changes.begin() + lastWord, 0);
+		kernels::findChanges(_values.data() + first, _oldValues.data() + first, last - first, _changes.data() + firstWord);
+
+		// Only process the values that changed
+		std::size_t changedCount = 0;
+		for (auto wordIndex = firstWord; wordIndex < lastWord; ++wordIndex)
+		{
+			changedCount += std::size_t(std::popcount(_changes[wordIndex]));
+			for (auto word = _changes[wordIndex]; word != 0; word &= word - 1)
+			{
+				const auto index = wordIndex * 64 + std::size_t(std::countr_zero(word));
+				_entries[index]._state.get().markChanged(writeSentinel, timeStamp, eventsToRaise);
+			}
+		}
+		return changedCount;
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+template <typename ValueType>
+auto ReadBatch<ValueType>::update(WriteSentinel &writeSentinel,
+	std::chrono::system_clock::time_point timeStamp,
+	const utils::eh::expected<std::reference_wrapper<const ReadCommand::Payload>, std::error_code> &payloadOrError,
+	const CommonReadState::Changes &commonChanges,
+	std::size_t first,
+	std::size_t last,
+	PendingEventList &eventsToRaise,
+	ReadPhaseTimes &phaseTimes) -> std::size_t
+{
+	// Only the entries in the range are touched
+	const auto entries = std::span(_entries).subspan(first, last - first);
+
+	// Check if we have a valid payload. This is checked once for the entire batch, rather than once per value.
+	if (payloadOrError)
+	{
+		// Get the payload data
+		const auto data = payloadOrError->get().data();
+
+		// Decode integers and floating point values in runs first, and then update all the states
+		if constexpr (kUsesDecodeKernels)
+		{
+			const auto decodeStart = CycleClock::now();
+			decodeRuns(data, first, last);
+			phaseTimes.add(ReadPhase::Decode, CycleClock::now() - decodeStart);
+			return updateDecodedValues(writeSentinel, timeStamp, commonChanges, first, last, eventsToRaise);
+		}
+		// Decode other values individually
+		else
+		{
+			std::size_t changedCount = 0;
+			for (auto &&entry : entries)
+			{
+				// Decode the value from its precomputed location in the payload
+				const auto &descriptor = entry._descriptor;
+				const auto value = decodeValue<ValueType>(data.subspan(descriptor._offset, descriptor._size), descriptor._byteOrder);
+
+				// Update the read state
+				changedCount += entry._state.get().update(writeSentinel, timeStamp, value, commonChanges, eventsToRaise);
+			}
+			return changedCount;
+		}
+	}
+	// We have an error
+	else
+	{
+		// Construct the error only once for all the states
+		const utils::eh::expected<ValueType, std::error_code> error = utils::eh::unexpected(payloadOrError.error());
+
+		// Update all the states with the error
+		std::size_t changedCount = 0;
+		for (auto &&entry : entries)
+		{
+			changedCount += entry._state.get().update(writeSentinel, timeStamp, error, commonChanges, eventsToRaise);
+		}
+		return changedCount;
+	}
+}
+
+/// @class xentara::plugins::templateDriver::ReadBatch
+/// @todo change list of template instantiations to the supported types
+template class ReadBatch<bool>;
+template class ReadBatch<std::uint8_t>;
+template class ReadBatch<std::uint16_t>;
+template class ReadBatch<std::uint32_t>;
+template class ReadBatch<std::uint64_t>;
+template class ReadBatch<std::int8_t>;
+template class ReadBatch<std::int16_t>;
+template class ReadBatch<std::int32_t>;
+template class ReadBatch<std::int64_t>;
+template class ReadBatch<float>;
+template class ReadBatch<double>;
+template class ReadBatch<std::string>;
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,325 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "Types.hpp"
+#include "ByteOrder.hpp"
+#include "CommonReadState.hpp"
+#include "DataAddress.hpp"
+#include "DecodeKernels.hpp"
+#include "PerValueReadState.hpp"
+#include "ReadCommand.hpp"
+#include "ReadPhaseTimes.hpp"
+
+#include <xentara/memory/WriteSentinel.hpp>
+#include <xentara/utils/eh/expected.hpp>
+#include <xentara/utils/tools/Concepts.hpp>
+
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief A batch of read states for values of the same type that are updated together
+///
+/// The batch holds the read states of all inputs of a transaction that have the same value type, so that they can be
+/// updated in a single, non-virtual loop. This avoids two virtual function calls per input in the update, and lets
+/// the compiler specialize the decoding for the value type.
+///
+/// Integer and floating point values at adjacent addresses are decoded together as runs, using the vectorized kernels in
+/// DecodeKernels.hpp. The decoded values are collected in a contiguous array before the read states are updated, because
+/// the read states themselves are not stored contiguously in the data block. The old values are collected in the same way, so that
+/// changed values can be detected using vector comparisons. The change time and events are then only processed for the values
+/// that actually changed.
+///
+/// Large batches can be updated by several threads in parallel, with each thread updating a different range of entries.
+template <typename ValueType>
+class ReadBatch final
+{
+public:
+	/// @brief Adds a read state to the batch
+	/// @param state The read state to add. The read state must remain valid for as long as the batch is used.
+	/// @param address The address of the value in the I/O component
+	auto add(PerValueReadState<ValueType> &state, const DataAddress &address) -> void
+	{
+		_entries.push_back({ state, address._address, { ._size = address._size, ._byteOrder = address._byteOrder } });
+	}
+
+	/// @brief Checks whether the batch is empty
+	auto empty() const noexcept -> bool
+	{
+		return _entries.empty();
+	}
+
+	/// @brief Gets the number of read states in the batch
+	auto size() const noexcept -> std::size_t
+	{
+		return _entries.size();
+	}
+
+	/// @brief Computes the decode descriptors and runs of all the entries for a specific read command
+	///
+	/// This function reorders the entries by their offset in the payload, and allocates the buffers needed for decoding.
+	/// @param command The read command that reads the values of this batch. The command must cover
+	/// the addresses of all the values in the batch.
+	auto prepare(const ReadCommand &command) -> void;
+
+	/// @brief Updates all the read states in the batch and collects the events to send
+	/// @param writeSentinel A write sentinel for the data block the data is stored in
+	/// @param timeStamp The update time stamp
+	/// @param payloadOrError This is a variant-like type that will hold either the payload of the read command, or an std::error_code object
+	/// containing a read error. The payload must contain all the data the read command passed to prepare() requested.
+	/// @param commonChanges An object containing information about which parts of the common read state changed, if any.
+	/// @param eventsToRaise Any events that need to be raised as a result of the update will be added to this
+	/// list. The events will not be raised directly, because the write sentinel needs to be commited first,
+	/// which is done by the caller.
+	/// @param phaseTimes The time spent decoding values using the vectorized kernels is added to the *decode* phase of this object.
+	/// Values that are decoded individually are decoded while the read states are updated, and are not included.
+	/// @return The number of values that changed
+	auto update(WriteSentinel &writeSentinel,
+		std::chrono::system_clock::time_point timeStamp,
+		const utils::eh::expected<std::reference_wrapper<const ReadCommand::Payload>, std::error_code> &payloadOrError,
+		const CommonReadState::Changes &commonChanges,
+		PendingEventList &eventsToRaise,
+		ReadPhaseTimes &phaseTimes) -> std::size_t
+	{
+		return update(writeSentinel, timeStamp, payloadOrError, commonChanges, 0, _entries.size(), eventsToRaise, phaseTimes);
+	}
+
+	/// @brief Updates a range of the read states in the batch and collects the events to send
+	///
+	/// Different threads may update disjoint ranges of the same batch at the same time, as long as each range starts at a
+	/// multiple of kRangeAlignment. The entries are in the order of their offsets in the payload.
+	/// @param first The index of the first entry to update. This must be a multiple of kRangeAlignment.
+	/// @param last The index after the last entry to update
+	///
+	/// The other parameters are the same as for the other overload.
+	/// @return The number of values in the range that changed
+	auto update(WriteSentinel &writeSentinel,
+		std::chrono::system_clock::time_point timeStamp,
+		const utils::eh::expected<std::reference_wrapper<const ReadCommand::Payload>, std::error_code> &payloadOrError,
+		const CommonReadState::Changes &commonChanges,
+		std::size_t first,
+		std::size_t last,
+		PendingEventList &eventsToRaise,
+		ReadPhaseTimes &phaseTimes) -> std::size_t;
+
+	/// @brief The alignment of the ranges that can be updated in parallel
+	///
+	/// This is the number of entries that share a word of the bit mask of changed values.
+	static constexpr std::size_t kRangeAlignment = 64;
+
+private:
+	/// @brief Whether values of this type are decoded in runs using the vectorized kernels
+	static constexpr bool kUsesDecodeKernels =
+		!std::same_as<ValueType, bool> && (utils::tools::Integral<ValueType> || std::floating_point<ValueType>);
+
+	/// @brief Builds the runs of adjacent values with the same size and byte order
+	///
+	/// The entries must already be sorted by offset.
+	auto prepareRuns() -> void;
+
+	/// @brief Decodes the values of a range of entries into _values
+	/// @param data The payload data
+	/// @param first The index of the first entry to decode
+	/// @param last The index after the last entry to decode
+	auto decodeRuns(std::span<const std::byte> data, std::size_t first, std::size_t last) -> void;
+
+	/// @brief Updates a range of the read states with the values in _values
+	///
+	/// The parameters are the same as for update().
+	/// @return The number of values that changed
+	auto updateDecodedValues(WriteSentinel &writeSentinel,
+		std::chrono::system_clock::time_point timeStamp,
+		const CommonReadState::Changes &commonChanges,
+		std::size_t first,
+		std::size_t last,
+		PendingEventList &eventsToRaise) -> std::size_t;
+
+	/// @brief Information on where to find a value in the payload of a read command
+	struct DecodeDescriptor final
+	{
+		/// @brief The offset of the value within the payload
+		std::size_t _offset { 0 };
+		/// @brief The number of bytes the value occupies
+		std::size_t _size { 0 };
+		/// @brief The byte order of the value
+		ByteOrder _byteOrder { ByteOrder::BigEndian };
+	};
+
+	/// @brief An entry in the batch
+	struct Entry final
+	{
+		/// @brief The read state
+		std::reference_wrapper<PerValueReadState<ValueType>> _state;
+		/// @brief The address of the value in the I/O component
+		std::uint64_t _address { 0 };
+		/// @brief The information needed to decode the value. The offset is filled in by prepare().
+		DecodeDescriptor _descriptor;
+	};
+
+	/// @brief A run of adjacent values with the same size and byte order
+	struct Run final
+	{
+		/// @brief The index of the entry for the first value in the run
+		std::size_t _firstEntry { 0 };
+		/// @brief The number of values in the run
+		std::size_t _count { 0 };
+		/// @brief The offset of the first value within the payload
+		std::size_t _offset { 0 };
+		/// @brief The conversion to native byte order
+		kernels::ByteShuffle _shuffle;
+		/// @brief The offset of the part of _widenBuffer used by the run, if the values must be widened
+		std::size_t _widenOffset { 0 };
+	};
+
+	/// @brief The entries for the inputs in the batch
+	std::vector<Entry> _entries;
+
+	/// @brief The runs of values, if the values are decoded using the kernels
+	std::vector<Run> _runs;
+	/// @brief The decoded values, in the same order as the entries. This is only used if the values are decoded using the kernels.
+	std::vector<ValueType> _values;
+	/// @brief A buffer for values that must be widened after being converted to native byte order. Each run that needs widening
+	/// has its own part of the buffer, so that different ranges can be decoded at the same time.
+	std::vector<std::byte> _widenBuffer;
+	/// @brief The previous values, in the same order as the entries. This is only used if the values are decoded using the kernels.
+	std::vector<ValueType> _oldValues;
+	/// @brief A bit mask of the values that changed, with one bit per entry. This is only used if the values are decoded using the kernels.
+	std::vector<std::uint64_t> _changes;
+};
+
+/// @class xentara::plugins::templateDriver::ReadBatch
+/// @todo change list of extern template statements to the supported types
+extern template class ReadBatch<bool>;
+extern template class ReadBatch<std::uint8_t>;
+extern template class ReadBatch<std::uint16_t>;
+extern template class ReadBatch<std::uint32_t>;
+extern template class ReadBatch<std::uint64_t>;
+extern template class ReadBatch<std::int8_t>;
+extern template class ReadBatch<std::int16_t>;
+extern template class ReadBatch<std::int32_t>;
+extern template class ReadBatch<std::int64_t>;
+extern template class ReadBatch<float>;
+extern template class ReadBatch<double>;
+extern template class ReadBatch<std::string>;
+
+/// @brief The read batches for all supported value types
+class ReadBatchList final
+{
+public:
+	/// @brief Gets the batch for a specific value type
+	template <typename ValueType>
+	auto batch() noexcept -> ReadBatch<ValueType> &
+	{
+		return std::get<ReadBatch<ValueType>>(_batches);
+	}
+
+	/// @brief Gets an index that identifies a value type
+	///
+	/// This can be used to group values by type without knowing the type at compile time.
+	template <typename ValueType>
+	static constexpr auto valueTypeIndex() noexcept -> std::size_t
+	{
+		return []<typename... Batches>(std::type_identity<std::tuple<Batches...>>)
+		{
+			std::size_t index = 0;
+			static_cast<void>(((std::same_as<Batches, ReadBatch<ValueType>> || (++index, false)) || ...));
+			return index;
+		}(std::type_identity<BatchTuple>());
+	}
+
+	/// @brief Calls a function for each of the batches
+	/// @param function The function to call. The function must accept a reference to a batch of any value type.
+	template <typename Function>
+	auto forEachBatch(Function &&function) -> void
+	{
+		std::apply([&](auto &...batches) { (function(batches), ...); }, _batches);
+	}
+
+	/// @brief Gets the total number of read states in all the batches
+	auto size() const noexcept -> std::size_t
+	{
+		return std::apply([](const auto &...batches) { return (batches.size() + ...); }, _batches);
+	}
+
+	/// @brief Updates all the read states in all the batches and collects the events to send
+	///
+	/// The parameters are the same as for ReadBatch::update().
+	/// @return The number of values that changed
+	auto update(WriteSentinel &writeSentinel,
+		std::chrono::system_clock::time_point timeStamp,
+		const utils::eh::expected<std::reference_wrapper<const ReadCommand::Payload>, std::error_code> &payloadOrError,
+		const CommonReadState::Changes &commonChanges,
+		PendingEventList &eventsToRaise,
+		ReadPhaseTimes &phaseTimes) -> std::size_t
+	{
+		std::size_t changedCount = 0;
+		forEachBatch([&](auto &batch)
+			{
+				// Skip batches for value types that are not used by any input
+				if (!batch.empty())
+				{
+					changedCount += batch.update(writeSentinel, timeStamp, payloadOrError, commonChanges, eventsToRaise, phaseTimes);
+				}
+			});
+		return changedCount;
+	}
+
+	/// @brief Updates a range of the read states in one of the batches and collects the events to send
+	///
+	/// The parameters are the same as for ReadBatch::update().
+	/// @param batchIndex The index of the batch, as returned by valueTypeIndex()
+	/// @return The number of values that changed
+	auto update(std::size_t batchIndex,
+		WriteSentinel &writeSentinel,
+		std::chrono::system_clock::time_point timeStamp,
+		const utils::eh::expected<std::reference_wrapper<const ReadCommand::Payload>, std::error_code> &payloadOrError,
+		const CommonReadState::Changes &commonChanges,
+		std::size_t first,
+		std::size_t last,
+		PendingEventList &eventsToRaise,
+		ReadPhaseTimes &phaseTimes) -> std::size_t
+	{
+		std::size_t changedCount = 0;
+		std::size_t index = 0;
+		forEachBatch([&](auto &batch)
+			{
+				if (index++ == batchIndex)
+				{
+					changedCount = batch.update(writeSentinel, timeStamp, payloadOrError, commonChanges, first, last, eventsToRaise, phaseTimes);
+				}
+			});
+		return changedCount;
+	}
+
+private:
+	/// @brief The type of the tuple holding the batches
+	/// @todo change list of batches to the supported types
+	using BatchTuple = std::tuple<
+		ReadBatch<bool>,
+		ReadBatch<std::uint8_t>,
+		ReadBatch<std::uint16_t>,
+		ReadBatch<std::uint32_t>,
+		ReadBatch<std::uint64_t>,
+		ReadBatch<std::int8_t>,
+		ReadBatch<std::int16_t>,
+		ReadBatch<std::int32_t>,
+		ReadBatch<std::int64_t>,
+		ReadBatch<float>,
+		ReadBatch<double>,
+		ReadBatch<std::string>>;
+
+	/// @brief The batches
+	BatchTuple _batches;
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
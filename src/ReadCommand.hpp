@@ -3,19 +3,93 @@
 
 #include <xentara/utils/tools/Unique.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
 namespace xentara::plugins::templateDriver
 {
 
 /// @brief A command used to read inputs
-/// @todo implement a proper read command
+///
+/// The command reads a contiguous range of addresses from the I/O component. The response is received directly
+/// into a buffer that is allocated once when the command is created, so that no allocations are necessary when reading.
+/// @todo add any additional information the I/O component needs to process the command
 class ReadCommand final : private utils::tools::Unique
 {
 public:
-	/// @brief Some class that represents the data received from the device
-	/// @todo use a suitable class to represent the data
+	/// @brief The data received from the device
+	///
+	/// The payload does not contain the data itself, but refers to the receive buffer of the read command, so that the
+	/// data need not be copied.
 	class Payload final
 	{
+	public:
+		/// @brief The default constructor creates an empty payload
+		constexpr Payload() noexcept = default;
+
+		/// @brief This constructor creates a payload that refers to some data
+		constexpr explicit Payload(std::span<const std::byte> data) noexcept : _data(data)
+		{
+		}
+
+		/// @brief Gets the data
+		constexpr auto data() const noexcept -> std::span<const std::byte>
+		{
+			return _data;
+		}
+
+		/// @brief Gets the size of the data in bytes
+		constexpr auto size() const noexcept -> std::size_t
+		{
+			return _data.size();
+		}
+
+	private:
+		/// @brief The data
+		std::span<const std::byte> _data;
 	};
+
+	/// @brief This constructor creates a command for a specific address range
+	/// @param address The first address to read
+	/// @param size The number of bytes to read
+	ReadCommand(std::uint64_t address, std::size_t size) : _address(address), _receiveBuffer(size)
+	{
+	}
+
+	/// @brief Gets the first address to read
+	constexpr auto address() const noexcept -> std::uint64_t
+	{
+		return _address;
+	}
+
+	/// @brief Gets the number of bytes to read
+	auto size() const noexcept -> std::size_t
+	{
+		return _receiveBuffer.size();
+	}
+
+	/// @brief Gets the buffer the response should be received into
+	auto receiveBuffer() noexcept -> std::span<std::byte>
+	{
+		return _receiveBuffer;
+	}
+
+	/// @brief Gets the payload of the response
+	/// @param receivedSize The number of bytes that were actually received into the receive buffer.
+	auto payload(std::size_t receivedSize) const noexcept -> Payload
+	{
+		return Payload(std::span<const std::byte>(_receiveBuffer).first(std::min(receivedSize, _receiveBuffer.size())));
+	}
+
+private:
+	/// @brief The first address to read
+	std::uint64_t _address;
+
+	/// @brief The buffer the response is received into
+	std::vector<std::byte> _receiveBuffer;
 };
 
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
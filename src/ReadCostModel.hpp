@@ -0,0 +1,25 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <cstddef>
+#include <limits>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief The estimated cost of read commands
+///
+/// The cost model is used when splitting the inputs of a transaction into read commands, to decide whether it is cheaper
+/// to read the unused addresses between two values, or to use a separate command for each of them.
+/// @todo adapt the default values to the I/O component
+struct ReadCostModel final
+{
+	/// @brief The fixed cost of a single read command, e.g. the round trip time in microseconds
+	double _commandCost { 1.0 };
+	/// @brief The cost of each byte read, e.g. the transmission time of a byte in microseconds
+	double _byteCost { 0.0 };
+	/// @brief The largest range of unused addresses a single command may read across, in bytes
+	std::size_t _maxGap { std::numeric_limits<std::size_t>::max() };
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
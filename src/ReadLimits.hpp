@@ -0,0 +1,23 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <cstddef>
+#include <limits>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief The limits the I/O component imposes on a single read command
+/// @todo adapt this to the limits of the I/O component
+struct ReadLimits final
+{
+	/// @brief The maximum number of bytes a single read command can read
+	/// @todo use the maximum payload size of the I/O component
+	std::size_t _maxSize { std::numeric_limits<std::size_t>::max() };
+	/// @brief The maximum number of values a single read command can read
+	std::size_t _maxValueCount { std::numeric_limits<std::size_t>::max() };
+	/// @brief Whether values of different types must be read using separate commands
+	bool _separateValueTypes { false };
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
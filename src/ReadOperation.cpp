@@ -0,0 +1,95 @@
+// Copyright (c) embedded ocean GmbH
+#include "ReadOperation.hpp"
+
+#include <xentara/memory/WriteSentinel.hpp>
+
+#include <algorithm>
+#include <functional>
+
+namespace xentara::plugins::templateDriver
+{
+
+// Chunks must not share any words of the change masks of the batches
+static_assert(ReadOperation::kChunkSize % ReadBatch<std::int32_t>::kRangeAlignment == 0);
+
+auto ReadOperation::prepare() -> void
+{
+	// Compute the offsets of the values within the payload once, so that decoding does not have to do it every cycle
+	_batches.forEachBatch([&](auto &batch) { batch.prepare(_command); });
+
+	// Divide the inputs into chunks, so that large batches can be updated by several threads
+	_chunks.clear();
+	std::size_t batchIndex = 0;
+	_batches.forEachBatch([&](auto &batch)
+		{
+			for (std::size_t first = 0; first < batch.size(); first += kChunkSize)
+			{
+				_chunks.push_back({ batchIndex, first, std::min(first + kChunkSize, batch.size()) });
+			}
+			++batchIndex;
+		});
+}
+
+auto ReadOperation::update(WriteSentinel &writeSentinel,
+	std::chrono::system_clock::time_point timeStamp,
+	PendingEventList &eventsToRaise,
+	ReadPhaseTimes &phaseTimes) -> std::size_t
+{
+	// Update the read state
+	const auto commonChanges = _readState.update(writeSentinel, timeStamp, error());
+
+	// Update all the inputs, one batch of inputs with the same value type at a time
+	if (_result)
+	{
+		return _batches.update(writeSentinel, timeStamp, std::cref(*_result), commonChanges, eventsToRaise, phaseTimes);
+	}
+	else
+	{
+		return _batches.update(writeSentinel, timeStamp, utils::eh::unexpected(_result.error()), commonChanges, eventsToRaise, phaseTimes);
+	}
+}
+
+auto ReadOperation::update(WriteSentinel &writeSentinel,
+	std::chrono::system_clock::time_point timeStamp,
+	std::error_code error,
+	PendingEventList &eventsToRaise,
+	ReadPhaseTimes &phaseTimes) -> std::size_t
+{
+	// Update the read state and all the inputs using the error
+	const auto commonChanges = _readState.update(writeSentinel, timeStamp, error);
+	return _batches.update(writeSentinel, timeStamp, utils::eh::unexpected(error), commonChanges, eventsToRaise, phaseTimes);
+}
+
+auto ReadOperation::beginUpdate(WriteSentinel &writeSentinel, std::chrono::system_clock::time_point timeStamp) -> void
+{
+	_updateError = error();
+	_updateChanges = _readState.update(writeSentinel, timeStamp, _updateError);
+}
+
+auto ReadOperation::beginUpdate(WriteSentinel &writeSentinel, std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void
+{
+	_updateError = error;
+	_updateChanges = _readState.update(writeSentinel, timeStamp, _updateError);
+}
+
+auto ReadOperation::updateChunk(std::size_t chunk,
+	WriteSentinel &writeSentinel,
+	std::chrono::system_clock::time_point timeStamp,
+	PendingEventList &eventsToRaise,
+	ReadPhaseTimes &phaseTimes) -> std::size_t
+{
+	const auto &[batch, first, last] = _chunks[chunk];
+
+	// Update the inputs in the chunk using the payload, if we have one
+	if (!_updateError)
+	{
+		return _batches.update(batch, writeSentinel, timeStamp, std::cref(*_result), _updateChanges, first, last, eventsToRaise, phaseTimes);
+	}
+	else
+	{
+		return _batches.update(
+			batch, writeSentinel, timeStamp, utils::eh::unexpected(_updateError), _updateChanges, first, last, eventsToRaise, phaseTimes);
+	}
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
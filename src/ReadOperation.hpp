@@ -0,0 +1,194 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "Types.hpp"
+#include "CustomError.hpp"
+#include "ReadBatch.hpp"
+#include "ReadCommand.hpp"
+#include "ReadOperationState.hpp"
+#include "ReadPhaseTimes.hpp"
+
+#include <xentara/memory/Array.hpp>
+#include <xentara/utils/eh/expected.hpp>
+#include <xentara/utils/tools/Unique.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief One of the read commands of an I/O transaction, together with the inputs it reads
+///
+/// Each read operation has its own read state, so that an error executing one command only affects the inputs read
+/// by that command.
+///
+/// The inputs are divided into chunks, so that the inputs of a single command can be updated by several threads in parallel.
+class ReadOperation final : private utils::tools::Unique
+{
+public:
+	/// @brief The maximum number of inputs in a chunk. This must be a multiple of ReadBatch::kRangeAlignment.
+	static constexpr std::size_t kChunkSize = 4096;
+
+	/// @brief This constructor creates an operation for a specific address range
+	/// @param address The first address to read
+	/// @param size The number of bytes to read
+	ReadOperation(std::uint64_t address, std::size_t size) : _command(address, size)
+	{
+	}
+
+	/// @brief Gets the read command
+	auto command() noexcept -> ReadCommand &
+	{
+		return _command;
+	}
+	/// @overload
+	auto command() const noexcept -> const ReadCommand &
+	{
+		return _command;
+	}
+
+	/// @brief Gets the read state
+	auto readState() const noexcept -> const ReadOperationState &
+	{
+		return _readState;
+	}
+
+	/// @brief Gets the read batches of the inputs read by the command
+	auto batches() noexcept -> ReadBatchList &
+	{
+		return _batches;
+	}
+
+	/// @brief Attaches the read state to the I/O transaction
+	/// @param dataArray The data array that the attributes should be added to. The caller will use the information in this array
+	/// to allocate the data block.
+	/// @note The read state of an operation does not raise any events, so it does not contribute to the event count.
+	auto attach(memory::Array &dataArray) -> void
+	{
+		_readState.attach(dataArray);
+	}
+
+	/// @brief Computes the decode descriptors of all the inputs read by the command, and divides the inputs into chunks
+	auto prepare() -> void;
+
+	/// @brief Gets the number of chunks the inputs are divided into
+	auto chunkCount() const noexcept -> std::size_t
+	{
+		return _chunks.size();
+	}
+
+	/// @brief Records the payload received for the command
+	/// @param payload The payload. The payload must contain all the data the command requested.
+	auto setPayload(const ReadCommand::Payload &payload) noexcept -> void
+	{
+		_result = payload;
+	}
+
+	/// @brief Records an error executing the command
+	auto setError(std::error_code error) noexcept -> void
+	{
+		_result = utils::eh::unexpected(error);
+	}
+
+	/// @brief Gets the error recorded for the command
+	/// @return The error, or a default constructed std::error_code object if the command was successful
+	auto error() const noexcept -> std::error_code
+	{
+		return _result ? std::error_code() : _result.error();
+	}
+
+	/// @brief Updates the read state and the inputs using the recorded payload or error, and collects the events to send
+	/// @param writeSentinel A write sentinel for the data block the data is stored in
+	/// @param timeStamp The update time stamp
+	/// @param eventsToRaise Any events that need to be raised as a result of the update will be added to this
+	/// list. The events will not be raised directly, because the write sentinel needs to be commited first,
+	/// which is done by the caller.
+	/// @param phaseTimes The time spent decoding values is added to the *decode* phase of this object.
+	/// @return The number of input values that changed
+	auto update(WriteSentinel &writeSentinel,
+		std::chrono::system_clock::time_point timeStamp,
+		PendingEventList &eventsToRaise,
+		ReadPhaseTimes &phaseTimes) -> std::size_t;
+
+	/// @brief Updates the read state and the inputs using an error instead of the recorded result
+	///
+	/// This is used if the command did not complete in time. The recorded result is not accessed, because the I/O worker
+	/// may still be recording it.
+	/// @param writeSentinel A write sentinel for the data block the data is stored in
+	/// @param timeStamp The update time stamp
+	/// @param error The error
+	/// @param eventsToRaise Any events that need to be raised as a result of the update will be added to this list.
+	/// @param phaseTimes The time spent decoding values is added to the *decode* phase of this object.
+	/// @return The number of input values that changed
+	auto update(WriteSentinel &writeSentinel,
+		std::chrono::system_clock::time_point timeStamp,
+		std::error_code error,
+		PendingEventList &eventsToRaise,
+		ReadPhaseTimes &phaseTimes) -> std::size_t;
+
+	/// @brief Updates the read state using the recorded payload or error, as the first step of a chunked update
+	///
+	/// The inputs must then be updated by calling updateChunk() for each of the chunks. The chunks may be updated by
+	/// different threads in parallel.
+	/// @param writeSentinel A write sentinel for the data block the data is stored in
+	/// @param timeStamp The update time stamp
+	auto beginUpdate(WriteSentinel &writeSentinel, std::chrono::system_clock::time_point timeStamp) -> void;
+
+	/// @brief Updates the read state using an error instead of the recorded result, as the first step of a chunked update
+	///
+	/// The recorded result is not accessed by this function or by updateChunk(), like with the corresponding overload of update().
+	/// @param writeSentinel A write sentinel for the data block the data is stored in
+	/// @param timeStamp The update time stamp
+	/// @param error The error
+	auto beginUpdate(WriteSentinel &writeSentinel, std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void;
+
+	/// @brief Updates the inputs in one of the chunks, using the payload or error passed to beginUpdate()
+	/// @param chunk The index of the chunk
+	/// @param writeSentinel A write sentinel for the data block the data is stored in
+	/// @param timeStamp The update time stamp
+	/// @param eventsToRaise Any events that need to be raised as a result of the update will be added to this list.
+	/// @param phaseTimes The time spent decoding values is added to the *decode* phase of this object.
+	/// @return The number of input values that changed
+	auto updateChunk(std::size_t chunk,
+		WriteSentinel &writeSentinel,
+		std::chrono::system_clock::time_point timeStamp,
+		PendingEventList &eventsToRaise,
+		ReadPhaseTimes &phaseTimes) -> std::size_t;
+
+private:
+	/// @brief A range of inputs with the same value type
+	struct Chunk final
+	{
+		/// @brief The index of the batch, as returned by ReadBatchList::valueTypeIndex()
+		std::size_t _batch { 0 };
+		/// @brief The index of the first entry in the batch
+		std::size_t _first { 0 };
+		/// @brief The index after the last entry in the batch
+		std::size_t _last { 0 };
+	};
+
+	/// @brief The read command
+	ReadCommand _command;
+
+	/// @brief The read state of the inputs read by the command
+	ReadOperationState _readState;
+
+	/// @brief The read states of the inputs, grouped by value type
+	ReadBatchList _batches;
+	/// @brief The chunks of inputs
+	std::vector<Chunk> _chunks;
+
+	/// @brief The payload received for the command, or the error that occurred
+	utils::eh::expected<ReadCommand::Payload, std::error_code> _result { utils::eh::unexpected(CustomError::NoData) };
+
+	/// @brief The error used by the current chunked update, or a default constructed std::error_code object to use the payload
+	std::error_code _updateError;
+	/// @brief The changes to the read state in the current chunked update
+	ReadOperationState::Changes _updateChanges;
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,56 @@
+// Copyright (c) embedded ocean GmbH
+#include "ReadOperationState.hpp"
+
+#include "Attributes.hpp"
+
+#include <xentara/memory/WriteSentinel.hpp>
+
+namespace xentara::plugins::templateDriver
+{
+
+auto ReadOperationState::makeReadHandle(const DataBlock &dataBlock,
+	const model::Attribute &attribute) const noexcept -> std::optional<data::ReadHandle>
+{
+	// Try each readable attribute
+	if (attribute == model::Attribute::kUpdateTime)
+	{
+		return dataBlock.member(_stateHandle, &State::_updateTime);
+	}
+	else if (attribute == model::Attribute::kQuality)
+	{
+		return dataBlock.member(_stateHandle, &State::_quality);
+	}
+	else if (attribute == attributes::kError)
+	{
+		return dataBlock.member(_stateHandle, &State::_error);
+	}
+
+	return std::nullopt;
+}
+
+auto ReadOperationState::attach(memory::Array &dataArray) -> void
+{
+	// Add the state to the array
+	_stateHandle = dataArray.appendObject<State>();
+}
+
+auto ReadOperationState::update(
+		WriteSentinel &writeSentinel,
+		std::chrono::system_clock::time_point timeStamp,
+		std::error_code error) -> Changes
+{
+	// Get the correct array entry
+	auto &state = writeSentinel[_stateHandle];
+	const auto &oldState = writeSentinel.oldValues()[_stateHandle];
+
+	state._updateTime = timeStamp;
+	state._quality = error ? data::Quality::Bad : data::Quality::Good;
+	state._error = error;
+
+	// Detect changes
+	return {
+		._qualityChanged = state._quality != oldState._quality,
+		._errorChanged = state._error != oldState._error };
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,65 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "Types.hpp"
+#include "CommonReadState.hpp"
+#include "CustomError.hpp"
+
+#include <xentara/data/Quality.hpp>
+#include <xentara/data/ReadHandle.hpp>
+#include <xentara/memory/Array.hpp>
+
+#include <chrono>
+#include <optional>
+#include <system_error>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief Read state information for a single read operation of a transaction.
+///
+/// This class contains the update time, quality and error of the inputs read by a single read command. Unlike
+/// CommonReadState, it does not have a read event, because the operations of a transaction are not Xentara elements
+/// and cannot publish events. The read event is raised by the combined read state of the transaction instead.
+class ReadOperationState final
+{
+public:
+	/// @brief Changes that may occur when updating the data
+	using Changes = CommonReadState::Changes;
+
+	/// @brief Creates a read-handle for an attribute that belong to this state.
+	/// @param dataBlock The data block the data is stored in
+	/// @param attribute The attribute to create the handle for
+	/// @return A read handle for the attribute, or std::nullopt if the attribute is unknown
+	auto makeReadHandle(const DataBlock &dataBlock, const model::Attribute &attribute) const noexcept
+		-> std::optional<data::ReadHandle>;
+
+	/// @brief Attaches the state to its I/O transaction
+	/// @param dataArray The data array that the attributes should be added to. The caller will use the information in this array
+	/// to allocate the data block.
+	auto attach(memory::Array &dataArray) -> void;
+
+	/// @brief Updates the data
+	/// @param writeSentinel A write sentinel for the data block the data is stored in
+	/// @param timeStamp The update time stamp
+	/// @param error The error code, or a default constructed std::error_code object to reset the error
+	/// @return An object conmtaining information about which parts of the state changed, if any.
+	auto update(WriteSentinel &writeSentinel, std::chrono::system_clock::time_point timeStamp, std::error_code error) -> Changes;
+
+private:
+	/// @brief This structure is used to represent the state inside the memory block
+	struct State final
+	{
+		/// @brief The update time stamp
+		std::chrono::system_clock::time_point _updateTime { std::chrono::system_clock::time_point::min() };
+		/// @brief The quality of the value
+		data::Quality _quality { data::Quality::Bad };
+		/// @brief The error code when reading the value, or a default constructed std::error_code object for none.
+		std::error_code _error { CustomError::NoData };
+	};
+
+	/// @brief The array element that contains the state
+	memory::Array::ObjectHandle<State> _stateHandle;
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
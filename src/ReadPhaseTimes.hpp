@@ -0,0 +1,78 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "CycleClock.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief The phases of reading the inputs of a transaction
+enum class ReadPhase
+{
+	/// @brief Encoding the read commands and submitting them to the I/O worker
+	Submit,
+	/// @brief Waiting for the responses, including the transfer and the processing time of the I/O component
+	Wait,
+	/// @brief Decoding the values from the payloads using the vectorized kernels
+	Decode,
+	/// @brief Updating the read states of the inputs, including decoding values that are not decoded by the kernels
+	Update,
+	/// @brief Committing the data block and raising the events
+	Commit
+};
+
+/// @brief The number of read phases
+constexpr std::size_t kReadPhaseCount = 5;
+
+/// @brief The time spent in each phase of a read, in ticks of the CycleClock
+class ReadPhaseTimes final
+{
+public:
+	/// @brief Adds a number of ticks to a phase
+	auto add(ReadPhase phase, std::uint64_t ticks) noexcept -> void
+	{
+		_ticks[std::size_t(phase)] += ticks;
+	}
+
+	/// @brief Adds the time since a start time to a phase, and advances the start time to the current time
+	/// @param phase The phase
+	/// @param start The start time of the phase. This is set to the current time, which is the start time of the next phase.
+	auto lap(ReadPhase phase, std::uint64_t &start) noexcept -> void
+	{
+		const auto now = CycleClock::now();
+		add(phase, now - start);
+		start = now;
+	}
+
+	/// @brief Gets the ticks of a phase
+	auto operator[](ReadPhase phase) const noexcept -> std::uint64_t
+	{
+		return _ticks[std::size_t(phase)];
+	}
+
+	/// @brief Adds the times of another object to this one
+	auto operator+=(const ReadPhaseTimes &other) noexcept -> ReadPhaseTimes &
+	{
+		for (std::size_t index = 0; index < kReadPhaseCount; ++index)
+		{
+			_ticks[index] += other._ticks[index];
+		}
+		return *this;
+	}
+
+	/// @brief Sets all the times to zero
+	auto clear() noexcept -> void
+	{
+		_ticks = {};
+	}
+
+private:
+	/// @brief The ticks of each phase
+	std::array<std::uint64_t, kReadPhaseCount> _ticks {};
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
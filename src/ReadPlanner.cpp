@@ -0,0 +1,147 @@
+// Copyright (c) embedded ocean GmbH
+#include "ReadPlanner.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+
+namespace xentara::plugins::templateDriver
+{
+
+namespace
+{
+
+	/// @brief Creates a planned read for a run of consecutive items
+	/// @param items All the items
+	/// @param run The indices of the items in the run, sorted by address
+	auto makePlannedRead(std::span<const ReadItem> items, std::span<const std::size_t> run) -> PlannedRead
+	{
+		PlannedRead read { items[run.front()]._address, 0, 0, { run.begin(), run.end() } };
+
+		// Determine the size, and count the bytes that are covered by the values
+		std::uint64_t end = read._address;
+		std::size_t usedSize = 0;
+		for (auto index : run)
+		{
+			const auto &item = items[index];
+			const auto itemEnd = item._address + item._size;
+			if (itemEnd > end)
+			{
+				// Only count the part that does not overlap the previous values
+				usedSize += std::size_t(itemEnd - std::max(end, item._address));
+				end = itemEnd;
+			}
+		}
+
+		read._size = std::size_t(end - read._address);
+		read._unusedSize = read._size - usedSize;
+		return read;
+	}
+
+	/// @brief Plans the reads for a group of items that may be read together
+	/// @param items All the items
+	/// @param group The indices of the items in the group, sorted by address
+	/// @param limits The limits of the I/O component
+	/// @param costModel The estimated cost of the read commands
+	/// @param reads The planned reads will be added to this list
+	auto planGroup(std::span<const ReadItem> items,
+		std::span<const std::size_t> group,
+		const ReadLimits &limits,
+		const ReadCostModel &costModel,
+		std::vector<PlannedRead> &reads) -> void
+	{
+		const auto count = group.size();
+
+		// Determine which items are separated from the previous ones by a gap that is too large to read across
+		std::vector<bool> separated(count, false);
+		std::uint64_t end = 0;
+		for (std::size_t position = 0; position < count; ++position)
+		{
+			const auto &item = items[group[position]];
+			separated[position] = position > 0 && item._address > end && item._address - end > costModel._maxGap;
+			end = std::max(end, item._address + item._size);
+		}
+
+		// Find the cheapest split using dynamic programming. cost[position] is the lowest cost for reading the
+		// first *position* items, and start[position] is the first item of the last command used for that.
+		std::vector<double> cost(count + 1, std::numeric_limits<double>::infinity());
+		std::vector<std::size_t> start(count + 1, 0);
+		cost[0] = 0;
+		for (std::size_t last = 0; last < count; ++last)
+		{
+			// Try all the possible first items for a command that ends with *last*, going backwards until a limit is reached
+			std::uint64_t commandEnd = 0;
+			for (std::size_t first = last + 1; first-- > 0;)
+			{
+				const auto &item = items[group[first]];
+				commandEnd = std::max(commandEnd, item._address + item._size);
+				const auto size = std::size_t(commandEnd - item._address);
+				if (size > limits._maxSize || last - first + 1 > limits._maxValueCount)
+				{
+					break;
+				}
+
+				const auto candidate = cost[first] + costModel._commandCost + costModel._byteCost * double(size);
+				if (candidate < cost[last + 1])
+				{
+					cost[last + 1] = candidate;
+					start[last + 1] = first;
+				}
+
+				// Don't read across gaps that are too large
+				if (separated[first])
+				{
+					break;
+				}
+			}
+		}
+
+		// Collect the commands, working backwards from the last item
+		const auto firstRead = reads.size();
+		for (auto position = count; position > 0; position = start[position])
+		{
+			reads.push_back(makePlannedRead(items, group.subspan(start[position], position - start[position])));
+		}
+		std::reverse(reads.begin() + std::ptrdiff_t(firstRead), reads.end());
+	}
+
+} // namespace
+
+auto planReads(std::span<const ReadItem> items, const ReadLimits &limits, const ReadCostModel &costModel) -> std::vector<PlannedRead>
+{
+	// Make sure all the items fit into a command at all
+	for (auto &&item : items)
+	{
+		if (item._size > limits._maxSize)
+		{
+			/// @todo replace "template data point" and "template I/O component" with more descriptive names
+			throw std::runtime_error("template data point is larger than the maximum read size of the template I/O component");
+		}
+	}
+
+	// Sort the items by address, grouping them by value type first if different types must be read separately
+	std::vector<std::size_t> order(items.size());
+	std::iota(order.begin(), order.end(), std::size_t(0));
+	const auto groupOf = [&](std::size_t index) { return limits._separateValueTypes ? items[index]._valueType : 0; };
+	std::ranges::stable_sort(order, {}, [&](std::size_t index)
+		{
+			const auto &item = items[index];
+			return std::tuple(groupOf(index), item._address, item._size);
+		});
+
+	// Plan each group separately
+	std::vector<PlannedRead> reads;
+	for (auto groupBegin = order.begin(); groupBegin != order.end();)
+	{
+		const auto group = groupOf(*groupBegin);
+		const auto groupEnd = std::find_if(groupBegin, order.end(), [&](std::size_t index) { return groupOf(index) != group; });
+		planGroup(items, std::span<const std::size_t>(groupBegin, groupEnd), limits, costModel, reads);
+		groupBegin = groupEnd;
+	}
+
+	return reads;
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
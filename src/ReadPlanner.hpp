@@ -0,0 +1,52 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "ReadCostModel.hpp"
+#include "ReadLimits.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief A value that must be read by one of the read commands of a transaction
+struct ReadItem final
+{
+	/// @brief The address of the first byte of the value
+	std::uint64_t _address { 0 };
+	/// @brief The number of bytes the value occupies
+	std::size_t _size { 0 };
+	/// @brief An index identifying the value type. Values with different types are only read using the same command
+	/// if the limits allow it.
+	std::size_t _valueType { 0 };
+};
+
+/// @brief A read command created by planReads()
+struct PlannedRead final
+{
+	/// @brief The first address to read
+	std::uint64_t _address { 0 };
+	/// @brief The number of bytes to read
+	std::size_t _size { 0 };
+	/// @brief The number of bytes read that do not belong to any of the values
+	std::size_t _unusedSize { 0 };
+	/// @brief The indices of the items read by the command, ordered by address
+	std::vector<std::size_t> _items;
+};
+
+/// @brief Splits the values of a transaction into read commands that the I/O component can handle
+///
+/// The values are sorted by address, and split into runs of consecutive values so that the total estimated cost of all
+/// the commands is as small as possible. A command never reads across a range of unused addresses that is larger than
+/// the maximum gap of the cost model.
+/// @param items The values to read
+/// @param limits The limits of the I/O component
+/// @param costModel The estimated cost of the read commands
+/// @return The read commands. Every item is read by exactly one command.
+/// @throw std::runtime_error A value is larger than the maximum size of a read command
+auto planReads(std::span<const ReadItem> items, const ReadLimits &limits, const ReadCostModel &costModel) -> std::vector<PlannedRead>;
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -1,6 +1,8 @@
 // Copyright (c) embedded ocean GmbH
 #pragma once
 
+#include "Tracepoints.hpp"
+
 #include <xentara/utils/atomic/Optional.hpp>
 #include <xentara/utils/atomic/UniquePointer.hpp>
 
@@ -26,6 +28,7 @@ public:
 	/// @param value The value to place in the queue
 	auto enqueue(const value_type &value) noexcept -> void
 	{
+		TEMPLATE_DRIVER_TRACE_SCOPE(enqueue, this, 1, sizeof(value_type));
 		_value.store(value, std::memory_order_release);
 	}
 
@@ -33,6 +36,7 @@ public:
 	/// @return The scheduled value or std::nullopt if none was scheduled since the last call
 	auto dequeue() noexcept -> std::optional<value_type>
 	{
+		TEMPLATE_DRIVER_TRACE_SCOPE(dequeue, this, 1, sizeof(value_type));
 		return _value.exchange(std::nullopt, std::memory_order_acq_rel);
 	}
 
@@ -59,11 +63,14 @@ public:
 	template <typename... Arguments> requires std::constructible_from<value_type, Arguments &&...>
 	auto enqueue(Arguments &&... arguments) noexcept -> void
 	{
-		_value.store(std::make_unique<value_type>(std::forward<Arguments>(arguments)...), std::memory_order_release);
+		auto value = std::make_unique<value_type>(std::forward<Arguments>(arguments)...);
+		TEMPLATE_DRIVER_TRACE_SCOPE(enqueue, this, 1, value->size() * sizeof(Char));
+		_value.store(std::move(value), std::memory_order_release);
 	}
 
 	/// @brief Gets the last scheduled value and removes it from the queue
 	/// @return The scheduled value or std::nullopt if none was scheduled since the last call
+	/// @note The byte count of the tracepoints of this function is zero, because the size of the string is not known on entry
 	auto dequeue() noexcept -> std::optional<value_type>;
 
 private:
@@ -74,6 +81,7 @@ private:
 template <class Char, class Traits, class Allocator>
 auto SingleValueQueue<std::basic_string<Char, Traits, Allocator>>::dequeue() noexcept -> std::optional<value_type>
 {
+	TEMPLATE_DRIVER_TRACE_SCOPE(dequeue, this, 1, 0);
 	if (auto value = _value.exchange(nullptr, std::memory_order_acq_rel))
 	{
 		return std::move(*value);
@@ -14,7 +14,11 @@ auto Skill::createElement(const skill::Element::Class &elementClass, skill::Elem
 {
 	if (&elementClass == &TemplateIoComponent::Class::instance())
 	{
-		return factory.makeShared<TemplateIoComponent>();
+		return factory.makeShared<TemplateIoComponent>(_ioWorkerGroups, _decodePool, _ioThreadDefaults);
+	}
+	else if (&elementClass == &TemplatePollingGroup::Class::instance())
+	{
+		return factory.makeShared<TemplatePollingGroup>();
 	}
 
 	/// @todo handle any additional top-level element classes
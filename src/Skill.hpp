@@ -1,10 +1,14 @@
 // Copyright (c) embedded ocean GmbH
 #pragma once
 
+#include "DecodePool.hpp"
+#include "IoWorkerGroups.hpp"
 #include "TemplateIoComponent.hpp"
 #include "TemplateIoTransaction.hpp"
 #include "TemplateOutput.hpp"
 #include "TemplateInput.hpp"
+#include "TemplatePollingGroup.hpp"
+#include "ThreadOptions.hpp"
 
 #include <xentara/skill/Skill.hpp>
 #include <xentara/utils/core/Uuid.hpp>
@@ -44,10 +48,28 @@ private:
 		TemplateIoComponent::Class,
 		TemplateIoTransaction::Class,
 		TemplateOutput::Class,
-		TemplateInput::Class>;
+		TemplateInput::Class,
+		TemplatePollingGroup::Class>;
 
 	/// @brief The skill class object
 	static Class _class;
+
+	/// @brief The default options for the I/O worker threads
+	///
+	/// These are fixed when the driver is compiled, and cannot be configured. Each I/O component can override them in its
+	/// configuration.
+	/// @todo adjust the defaults to the target system, e.g. to keep the threads away from the CPUs of the Xentara scheduler
+	const ThreadOptions _ioThreadDefaults { ._cpus = {}, ._priority = std::nullopt, ._lockMemory = false, ._name = "io-worker" };
+	/// @brief The options for the decode threads
+	///
+	/// These are fixed when the driver is compiled, and cannot be configured.
+	/// @todo adjust the options to the target system, e.g. to keep the threads away from the CPUs of the Xentara scheduler
+	const ThreadOptions _decodeThreadOptions { ._cpus = {}, ._priority = std::nullopt, ._lockMemory = false, ._name = "decode" };
+
+	/// @brief The I/O workers shared between I/O components
+	IoWorkerGroups _ioWorkerGroups;
+	/// @brief The threads that help the I/O transactions update large numbers of inputs
+	DecodePool _decodePool { _decodeThreadOptions };
 };
 
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -17,4 +17,7 @@ const process::Task::Role kRead { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "
 /// @todo assign a unique UUID
 const process::Task::Role kWrite { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "write"sv };
 
+/// @todo assign a unique UUID
+const process::Task::Role kExchange { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "exchange"sv };
+
 } // namespace xentara::plugins::templateDriver::tasks
\ No newline at end of file
@@ -11,5 +11,7 @@ namespace xentara::plugins::templateDriver::tasks
 extern const process::Task::Role kRead;
 /// @brief A Xentara task used to write the data points attached to an I/O transaction
 extern const process::Task::Role kWrite;
+/// @brief A Xentara task used to write and read the data points attached to an I/O transaction using combined commands
+extern const process::Task::Role kExchange;
 
 } // namespace xentara::plugins::templateDriver::tasks
\ No newline at end of file
@@ -15,6 +15,10 @@
 #include <xentara/utils/json/decoder/Object.hpp>
 #include <xentara/utils/json/decoder/Errors.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
 namespace xentara::plugins::templateDriver
 {
 	
@@ -24,6 +28,8 @@ auto TemplateInput::load(utils::json::decoder::Object &jsonObject, config::Conte
 {
 	// Go through all the members of the JSON object that represents this object
 	bool ioTransactionLoaded = false;
+	bool addressLoaded = false;
+	std::optional<std::size_t> size;
 	for (auto && [name, value] : jsonObject)
     {
 		if (name == "dataType"sv)
@@ -41,6 +47,20 @@ auto TemplateInput::load(utils::json::decoder::Object &jsonObject, config::Conte
 				});
 			ioTransactionLoaded = true;
 		}
+		/// @todo use keywords and an address format that are appropriate to the I/O component
+		else if (name == "address"sv)
+		{
+			_dataAddress._address = value.asNumber<std::uint64_t>();
+			addressLoaded = true;
+		}
+		else if (name == "size"sv)
+		{
+			size = value.asNumber<std::size_t>();
+		}
+		else if (name == "byteOrder"sv)
+		{
+			_dataAddress._byteOrder = loadByteOrder(value);
+		}
 		/// @todo load custom configuration parameters
 		else if (name == "TODO"sv)
 		{
@@ -74,6 +94,24 @@ auto TemplateInput::load(utils::json::decoder::Object &jsonObject, config::Conte
 		/// @todo replace "I/O transaction" and "template input" with more descriptive names
 		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("missing I/O transaction in template input"));
 	}
+	// Make sure that an address was specified
+	if (!addressLoaded)
+	{
+		/// @todo replace "template input" with a more descriptive name
+		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("missing address in template input"));
+	}
+	// Determine the size of the value, using the default size for the data type if none was specified
+	_dataAddress._size = size.value_or(_handler->defaultSize());
+	if (_dataAddress._size == 0)
+	{
+		/// @todo replace "template input" with a more descriptive name
+		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("missing size in template input"));
+	}
+	if (!_handler->isValidSize(_dataAddress._size))
+	{
+		/// @todo replace "template input" with a more descriptive name
+		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("size is not valid for data type in template input"));
+	}
 	/// @todo perform consistency and completeness checks
 	if (!"TODO")
 	{
@@ -250,21 +288,30 @@ auto TemplateInput::attachInput(memory::Array &dataArray, std::size_t &eventCoun
 	_handler->attachReadState(dataArray, eventCount);
 }
 
-auto TemplateInput::updateReadState(WriteSentinel &writeSentinel,
-	std::chrono::system_clock::time_point timeStamp,
-	const utils::eh::expected<std::reference_wrapper<const ReadCommand::Payload>, std::error_code> &payloadOrError,
-	const CommonReadState::Changes &commonChanges,
-	PendingEventList &eventsToRaise) -> void
+auto TemplateInput::valueTypeIndex() const -> std::size_t
+{
+	// valueTypeIndex() must not be called before the configuration was loaded, so the handler should have been
+	// created already.
+	if (!_handler) [[unlikely]]
+	{
+		throw std::logic_error("internal error: xentara::plugins::templateDriver::TemplateInput::valueTypeIndex() called before configuration has been loaded");
+	}
+
+	// Forward the request to the handler
+	return _handler->valueTypeIndex();
+}
+
+auto TemplateInput::addToReadOperation(ReadOperation &operation) -> void
 {
-	// updateReadState() must not be called before the configuration was loaded, so the handler should have been
+	// addToReadOperation() must not be called before the configuration was loaded, so the handler should have been
 	// created already.
 	if (!_handler) [[unlikely]]
 	{
-		throw std::logic_error("internal error: xentara::plugins::templateDriver::TemplateInput::updateReadState() called before configuration has been loaded");
+		throw std::logic_error("internal error: xentara::plugins::templateDriver::TemplateInput::addToReadOperation() called before configuration has been loaded");
 	}
 
 	// Forward the request to the handler
-	_handler->updateReadState(writeSentinel, timeStamp, payloadOrError, commonChanges, eventsToRaise);
+	_handler->addToReadOperation(operation, _dataAddress);
 }
 
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
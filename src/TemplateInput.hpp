@@ -2,6 +2,7 @@
 #pragma once
 
 #include "AbstractInput.hpp"
+#include "DataAddress.hpp"
 #include "AbstractTemplateInputHandler.hpp"
 
 #include <xentara/skill/DataPoint.hpp>
@@ -61,11 +62,14 @@ public:
 	
 	auto attachInput(memory::Array &dataArray, std::size_t &eventCount) -> void final;
 
-	auto updateReadState(WriteSentinel &writeSentinel,
-		std::chrono::system_clock::time_point timeStamp,
-		const utils::eh::expected<std::reference_wrapper<const ReadCommand::Payload>, std::error_code> &payloadOrError,
-		const CommonReadState::Changes &commonChanges,
-		PendingEventList &eventsToRaise) -> void final;
+	auto dataAddress() const -> const DataAddress & final
+	{
+		return _dataAddress;
+	}
+
+	auto valueTypeIndex() const -> std::size_t final;
+
+	auto addToReadOperation(ReadOperation &operation) -> void final;
 		
 	/// @}
 
@@ -91,8 +95,8 @@ private:
 	/// @brief The handler for data type specific functionality, or nullptr, if the data type hans not been loaded yet
 	std::unique_ptr<AbstractTemplateInputHandler> _handler;
 
-	/// @class xentara::plugins::templateDriver::TemplateInput
-	/// @todo add information needed to decode the value from the payload of a read command, like e.g. a data offset.
+	/// @brief The address of the value in the I/O component
+	DataAddress _dataAddress;
 };
 
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include "TemplateInputHandler.hpp"
 
 #include "Attributes.hpp"
+#include "ReadBatch.hpp"
+#include "ReadOperation.hpp"
 #include "TemplateIoTransaction.hpp"
 
 #include <xentara/data/DataType.hpp>
@@ -48,6 +50,41 @@ auto TemplateInputHandler<ValueType>::dataType() const -> const data::DataType &
 	return kValueAttribute.dataType();
 }
 
+template <typename ValueType>
+auto TemplateInputHandler<ValueType>::defaultSize() const -> std::size_t
+{
+	/// @todo use the sizes the I/O component uses for the different value types
+	if constexpr (utils::tools::StringType<ValueType>)
+	{
+		// Strings have no default size
+		return 0;
+	}
+	else
+	{
+		return sizeof(ValueType);
+	}
+}
+
+template <typename ValueType>
+auto TemplateInputHandler<ValueType>::isValidSize(std::size_t size) const -> bool
+{
+	/// @todo check the size against the sizes the I/O component supports for the different value types
+	if constexpr (utils::tools::StringType<ValueType>)
+	{
+		// Strings can have any size
+		return size > 0;
+	}
+	// Integers can also be stored in fewer bytes, and will be sign or zero extended
+	else if constexpr (utils::tools::Integral<ValueType>)
+	{
+		return (size == 1 || size == 2 || size == 4 || size == 8) && size <= sizeof(ValueType);
+	}
+	else
+	{
+		return size == sizeof(ValueType);
+	}
+}
+
 template <typename ValueType>
 auto TemplateInputHandler<ValueType>::forEachAttribute(const model::ForEachAttributeFunction &function, TemplateIoTransaction &ioTransaction) const -> bool
 {
@@ -87,8 +124,8 @@ auto TemplateInputHandler<ValueType>::makeReadHandle(const model::Attribute &att
 	{
 		return handle;
 	}
-	// Also handle the common read state attributes from the I/O transaction
-	if (auto handle = ioTransaction.makeReadStateReadHandle(attribute))
+	// Also handle the common read state attributes from the read operation
+	if (auto handle = ioTransaction.makeReadStateReadHandle(_readOperation, attribute))
 	{
 		return handle;
 	}
@@ -103,57 +140,16 @@ auto TemplateInputHandler<ValueType>::attachReadState(memory::Array &dataArray,
 }
 
 template <typename ValueType>
-auto TemplateInputHandler<ValueType>::updateReadState(WriteSentinel &writeSentinel,
-	std::chrono::system_clock::time_point timeStamp,
-	const utils::eh::expected<std::reference_wrapper<const ReadCommand::Payload>, std::error_code> &payloadOrError,
-	const CommonReadState::Changes &commonChanges,
-	PendingEventList &eventsToRaise) -> void
+auto TemplateInputHandler<ValueType>::valueTypeIndex() const -> std::size_t
 {
-	// Check if we have a valid payload
-	if (payloadOrError)
-	{
-		/// @todo decode the value from the payload data
-		ValueType value = {};
-		
-		/// @todo it may be advantageous to split the decoding of the value up according to value type, either by using helper functions,
-		/// or using if constexpr().
-		//
-		// For example, you could create a function decodeValue(), which would call helper functions named decodeBoolean(), decodeInteger(),
-		// decodeFloatingPoint(), and decodeString(). This function could be implemented like this:
-		// 
-		// template <typename ValueType>
-		// auto TemplateInputHandler<ValueType>decodeValue(const ReadCommand::Payload &payload) -> dectype(auto)
-		// {
-		//     if constexpr (std::same_as<ValueType, bool>)
-		//     {
-		//         return decodeBoolean(payload);
-		//     }
-		//     else if constexpr (utils::Tools::Integral<ValueType>)
-		//     {
-		//         return decodeInteger(payload);
-		//     }
-		//     else if constexpr (std::floating_point<ValueType>)
-		//     {
-		//         return decodeFloatingPoint(payload);
-		//     }
-		//     else if constexpr (utils::tools::StringType<ValueType>)
-		//     {
-		//         return decodeString(payload);
-		//     }
-		// }
-		// 
-		// To determine if a type is an integer type, you should use xentara::utils::Tools::Integral instead of std::integral,
-		// because std::integral is true for *bool*, *char*, *wchar_t*, *char8_t*, *char16_t*, and *char32_t*, which is generally not desirable.
-
-		// Update the read state
-		_state.update(writeSentinel, timeStamp, value, commonChanges, eventsToRaise);	
-	}
-	// We have an error
-	else
-	{
-		// Update the state with the error
-		_state.update(writeSentinel, timeStamp, utils::eh::unexpected(payloadOrError.error()), commonChanges, eventsToRaise);
-	}
+	return ReadBatchList::valueTypeIndex<ValueType>();
+}
+
+template <typename ValueType>
+auto TemplateInputHandler<ValueType>::addToReadOperation(ReadOperation &operation, const DataAddress &address) -> void
+{
+	operation.batches().batch<ValueType>().add(_state, address);
+	_readOperation = &operation;
 }
 
 /// @class xentara::plugins::templateDriver::TemplateInputHandler
@@ -27,6 +27,10 @@ public:
 
 	auto dataType() const -> const data::DataType & final;
 
+	auto defaultSize() const -> std::size_t final;
+
+	auto isValidSize(std::size_t size) const -> bool final;
+
 	auto forEachAttribute(const model::ForEachAttributeFunction &function, TemplateIoTransaction &ioTransaction) const -> bool final;
 
 	auto forEachEvent(const model::ForEachEventFunction &function, TemplateIoTransaction &ioTransaction, std::shared_ptr<void> parent) -> bool final;
@@ -35,11 +39,9 @@ public:
 	
 	auto attachReadState(memory::Array &dataArray, std::size_t &eventCount) -> void final;
 
-	auto updateReadState(WriteSentinel &writeSentinel,
-		std::chrono::system_clock::time_point timeStamp,
-		const utils::eh::expected<std::reference_wrapper<const ReadCommand::Payload>, std::error_code> &payloadOrError,
-		const CommonReadState::Changes &commonChanges,
-		PendingEventList &eventsToRaise) -> void final;
+	auto valueTypeIndex() const -> std::size_t final;
+
+	auto addToReadOperation(ReadOperation &operation, const DataAddress &address) -> void final;
 		
 	/// @}
 
@@ -57,6 +59,9 @@ private:
 	/// @brief The state
 	/// @todo use the correct value type
 	PerValueReadState<ValueType> _state;
+
+	/// @brief The read operation that reads the value, or nullptr if the I/O transaction has not been realized yet
+	const ReadOperation *_readOperation { nullptr };
 };
 
 /// @class xentara::plugins::templateDriver::TemplateInputHandler
@@ -23,11 +23,114 @@ using namespace std::literals;
 
 auto TemplateIoComponent::load(utils::json::decoder::Object &jsonObject, config::Context &context) -> void
 {
+	std::size_t sessionCount { 1 };
+
 	// Go through all the members of the JSON object that represents this object
 	for (auto && [name, value] : jsonObject)
     {
+		/// @todo use keywords that are appropriate to the I/O component
+		if (name == "maxReadSize"sv)
+		{
+			_readLimits._maxSize = value.asNumber<std::size_t>();
+			if (_readLimits._maxSize == 0)
+			{
+				/// @todo replace "template I/O component" with a more descriptive name
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("maximum read size of template I/O component must not be zero"));
+			}
+		}
+		else if (name == "maxReadValues"sv)
+		{
+			_readLimits._maxValueCount = value.asNumber<std::size_t>();
+			if (_readLimits._maxValueCount == 0)
+			{
+				/// @todo replace "template I/O component" with a more descriptive name
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("maximum number of values per read of template I/O component must not be zero"));
+			}
+		}
+		else if (name == "separateReadTypes"sv)
+		{
+			_readLimits._separateValueTypes = value.asBool();
+		}
+		else if (name == "maxWriteSize"sv)
+		{
+			_writeLimits._maxSize = value.asNumber<std::size_t>();
+			if (_writeLimits._maxSize == 0)
+			{
+				/// @todo replace "template I/O component" with a more descriptive name
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("maximum write size of template I/O component must not be zero"));
+			}
+		}
+		else if (name == "maxWriteValues"sv)
+		{
+			_writeLimits._maxValueCount = value.asNumber<std::size_t>();
+			if (_writeLimits._maxValueCount == 0)
+			{
+				/// @todo replace "template I/O component" with a more descriptive name
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("maximum number of values per write of template I/O component must not be zero"));
+			}
+		}
+		else if (name == "ioWorker"sv)
+		{
+			_useIoWorker = value.asBool();
+		}
+		else if (name == "pipelineDepth"sv)
+		{
+			_pipelineDepth = value.asNumber<std::size_t>();
+			if (_pipelineDepth == 0)
+			{
+				/// @todo replace "template I/O component" with a more descriptive name
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("pipelining depth of template I/O component must not be zero"));
+			}
+		}
+		else if (name == "sessions"sv)
+		{
+			sessionCount = value.asNumber<std::size_t>();
+			if (sessionCount == 0)
+			{
+				/// @todo replace "template I/O component" with a more descriptive name
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("number of sessions of template I/O component must not be zero"));
+			}
+		}
+		else if (name == "ioWorkerGroup"sv)
+		{
+			_ioWorkerGroup = value.asNumber<std::size_t>();
+		}
+		else if (name == "normalPriorityWeight"sv)
+		{
+			_priorityWeights._normal = value.asNumber<std::size_t>();
+			if (_priorityWeights._normal == 0)
+			{
+				/// @todo replace "template I/O component" with a more descriptive name
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("normal priority weight of template I/O component must not be zero"));
+			}
+		}
+		else if (name == "bulkPriorityWeight"sv)
+		{
+			_priorityWeights._bulk = value.asNumber<std::size_t>();
+			if (_priorityWeights._bulk == 0)
+			{
+				/// @todo replace "template I/O component" with a more descriptive name
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("bulk priority weight of template I/O component must not be zero"));
+			}
+		}
+		else if (name == "threadCpus"sv)
+		{
+			_threadOptions._cpus = loadThreadCpus(value);
+		}
+		else if (name == "threadPriority"sv)
+		{
+			_threadOptions._priority = loadThreadPriority(value);
+		}
+		else if (name == "lockMemory"sv)
+		{
+			_threadOptions._lockMemory = value.asBool();
+		}
+		else if (name == "threadName"sv)
+		{
+			_threadOptions._name = loadThreadName(value);
+		}
 		/// @todo load configuration parameters
-		if (name == "TODO"sv)
+		else if (name == "TODO"sv)
 		{
 			/// @todo parse the value correctly
 			auto todo = value.asNumber<std::uint64_t>();
@@ -47,12 +150,34 @@ auto TemplateIoComponent::load(utils::json::decoder::Object &jsonObject, config:
 		}
     }
 
+	// A shared I/O worker group would have to block on sessions without a poll handle, holding up all the other I/O components
+	if (_ioWorkerGroup && !TemplateIoSession::kHasPollHandle)
+	{
+		/// @todo replace "template I/O component" with a more descriptive name
+		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("template I/O component cannot be assigned to an I/O worker group, because its sessions have no poll handle"));
+	}
+
+	// Only the I/O worker can use several sessions at the same time
+	if (sessionCount > 1 && !_useIoWorker)
+	{
+		/// @todo replace "template I/O component" with a more descriptive name
+		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("multiple sessions of template I/O component require the I/O worker"));
+	}
+
 	/// @todo perform consistency and completeness checks
 	if (!"TODO")
 	{
 		/// @todo use an error message that tells the user exactly what is wrong
 		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("TODO is wrong with template I/O component"));
 	}
+
+	// Create the sessions
+	_sessions.clear();
+	_sessions.reserve(sessionCount);
+	for (std::size_t index = 0; index < sessionCount; ++index)
+	{
+		_sessions.push_back(std::make_unique<TemplateIoSession>());
+	}
 }
 
 auto TemplateIoComponent::createChildElement(const skill::Element::Class &elementClass, skill::ElementFactory &factory)
@@ -78,27 +203,122 @@ auto TemplateIoComponent::createChildElement(const skill::Element::Class &elemen
 
 auto TemplateIoComponent::forEachAttribute(const model::ForEachAttributeFunction &function) const -> bool
 {
-	/// @todo call *function* with all attributes this class supports
+	return
+		// Handle the queue statistics attributes
+		function(attributes::kControlQueueWaitTime) ||
+		function(attributes::kNormalQueueWaitTime) ||
+		function(attributes::kBulkQueueWaitTime) ||
+
+		// Handle the thread attributes
+		function(attributes::kIoThreadCpuTime) ||
+		function(attributes::kDecodeThreadCpuTime) ||
 
-	return false;
+		// Handle the counter attributes
+		_counters.forEachAttribute(function);
+
+	/// @todo call *function* with any additional attributes this class supports
 }
 
 auto TemplateIoComponent::makeReadHandle(const model::Attribute &attribute) const noexcept -> std::optional<data::ReadHandle>
 {
-	/// @todo create read handles for any readable attributes this class supports
+	// Handle the queue statistics attributes
+	if (attribute == attributes::kControlQueueWaitTime)
+	{
+		return data::ReadHandle { _ioQueueStatistics.averageWaitTime(IoPriority::Control) };
+	}
+	if (attribute == attributes::kNormalQueueWaitTime)
+	{
+		return data::ReadHandle { _ioQueueStatistics.averageWaitTime(IoPriority::Normal) };
+	}
+	if (attribute == attributes::kBulkQueueWaitTime)
+	{
+		return data::ReadHandle { _ioQueueStatistics.averageWaitTime(IoPriority::Bulk) };
+	}
+
+	// Handle the thread attributes
+	if (attribute == attributes::kIoThreadCpuTime)
+	{
+		return data::ReadHandle { _ioQueueStatistics.threadCpuTime() };
+	}
+	if (attribute == attributes::kDecodeThreadCpuTime)
+	{
+		return data::ReadHandle { _decodePool.get().cpuTime() };
+	}
+
+	// Handle the counter attributes
+	if (auto handle = _counters.makeReadHandle(attribute))
+	{
+		return handle;
+	}
+
+	/// @todo create read handles for any additional readable attributes this class supports
 
 	// Nothing found
 	return std::nullopt;
 }
 
+auto TemplateIoComponent::connections() const -> std::vector<AbstractIoConnection *>
+{
+	std::vector<AbstractIoConnection *> connections;
+	connections.reserve(_sessions.size());
+	for (auto &&session : _sessions)
+	{
+		connections.push_back(session.get());
+	}
+	return connections;
+}
+
 auto TemplateIoComponent::prepare() -> void
 {
-	/// @todo open the handle for the I/O device
+	// Open all the sessions
+	for (auto &&session : _sessions)
+	{
+		session->open();
+	}
+
+	// Start the I/O worker, or join the shared worker group. Each session is a separate connection with its own pipeline.
+	const auto connections = this->connections();
+	if (!_useIoWorker)
+	{
+		_activeIoWorker = nullptr;
+	}
+	else if (_ioWorkerGroup)
+	{
+		_activeIoWorker = &_ioWorkerGroups.get().acquire(
+			*_ioWorkerGroup, _ioRequestCount, connections, _pipelineDepth, _priorityWeights, _threadOptions, _ioQueueStatistics);
+	}
+	else
+	{
+		for (auto &&connection : connections)
+		{
+			_ioWorker.addConnection(*connection, _pipelineDepth);
+		}
+		_ioWorker.start(_ioRequestCount, _priorityWeights, _threadOptions);
+		_ioWorker.addStatistics(_ioQueueStatistics);
+		_activeIoWorker = &_ioWorker;
+	}
 }
 
 auto TemplateIoComponent::cleanup() -> void
 {
-	/// @todo close the handle to the I/O device
+	// Stop the I/O worker or leave the worker group before closing the sessions, because the worker uses them
+	if (_activeIoWorker && _ioWorkerGroup)
+	{
+		_ioWorkerGroups.get().release(*_ioWorkerGroup, _ioRequestCount, connections(), _ioQueueStatistics);
+	}
+	_ioWorker.stop();
+	_ioWorker.removeStatistics(_ioQueueStatistics);
+	for (auto &&session : _sessions)
+	{
+		_ioWorker.removeConnection(*session);
+	}
+	_activeIoWorker = nullptr;
+
+	// Close all the sessions
+	for (auto &&session : _sessions)
+	{
+		session->close();
+	}
 }
 
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -3,14 +3,28 @@
 
 #include "Attributes.hpp"
 #include "CustomError.hpp"
+#include "DecodePool.hpp"
+#include "IoCounters.hpp"
+#include "IoPriority.hpp"
+#include "IoQueueStatistics.hpp"
+#include "IoWorker.hpp"
+#include "IoWorkerGroups.hpp"
+#include "ReadLimits.hpp"
+#include "TemplateIoSession.hpp"
+#include "ThreadOptions.hpp"
+#include "WriteLimits.hpp"
 
 #include <xentara/model/ElementCategory.hpp>
 #include <xentara/skill/Element.hpp>
 #include <xentara/utils/core/Uuid.hpp>
 #include <xentara/utils/tools/Unique.hpp>
 
+#include <atomic>
 #include <string_view>
 #include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
 
 namespace xentara::plugins::templateDriver
 {
@@ -30,16 +44,82 @@ public:
 		"deadbeef-dead-beef-dead-beefdeadbeef"_uuid,
 		"template driver I/O component">;
 
-	/// @brief A handle used to access the I/O component
-	/// @todo implement a proper handle
-	class Handle final : private utils::tools::Unique
+	/// @brief This constructor attaches the I/O component to the shared I/O workers and decode pool of the skill
+	/// @param ioWorkerGroups The shared I/O workers of the skill
+	/// @param decodePool The decode pool of the skill
+	/// @param threadDefaults The default options for the I/O worker thread, which can be overridden in the configuration
+	TemplateIoComponent(std::reference_wrapper<IoWorkerGroups> ioWorkerGroups,
+		std::reference_wrapper<DecodePool> decodePool,
+		const ThreadOptions &threadDefaults) :
+		_threadOptions(threadDefaults), _ioWorkerGroups(ioWorkerGroups), _decodePool(decodePool)
 	{
-	};
+	}
+
+	/// @brief Returns the session to send the next request over
+	///
+	/// The session with the fewest outstanding requests is used, so that requests are not queued behind a slow session
+	/// while another session is idle. Sessions with the same number of outstanding requests are used in turn.
+	auto nextSession() noexcept -> TemplateIoSession &
+	{
+		const auto sessionCount = _sessions.size();
+		const auto start = _nextSession.fetch_add(1, std::memory_order_relaxed);
+		auto *selected = _sessions[start % sessionCount].get();
+		auto selectedCount = selected->outstandingRequests();
+		for (std::size_t offset = 1; offset < sessionCount && selectedCount > 0; ++offset)
+		{
+			auto &session = *_sessions[(start + offset) % sessionCount];
+			if (const auto count = session.outstandingRequests(); count < selectedCount)
+			{
+				selected = &session;
+				selectedCount = count;
+			}
+		}
+		return *selected;
+	}
+
+	/// @brief Returns the limits the I/O component imposes on a single read command
+	auto readLimits() const noexcept -> const ReadLimits &
+	{
+		return _readLimits;
+	}
+
+	/// @brief Returns the I/O worker, or nullptr if the I/O component does not use one
+	auto ioWorker() noexcept -> IoWorker *
+	{
+		return _activeIoWorker;
+	}
+
+	/// @brief Returns the pool of threads the transactions can use to update their inputs in parallel
+	auto decodePool() noexcept -> DecodePool &
+	{
+		return _decodePool;
+	}
+
+	/// @brief Returns the statistics about the time requests wait in the queue of the I/O worker
+	auto ioQueueStatistics() noexcept -> IoQueueStatistics &
+	{
+		return _ioQueueStatistics;
+	}
+
+	/// @brief Returns the counters of all the transactions of the component
+	auto counters() noexcept -> IoCounters &
+	{
+		return _counters;
+	}
+
+	/// @brief Reserves space in the queue of the I/O worker
+	///
+	/// This must be called by each transaction when it is realized, so that the queue can be allocated in prepare().
+	/// @param count The maximum number of requests the transaction can have outstanding at the same time
+	auto reserveIoRequests(std::size_t count) noexcept -> void
+	{
+		_ioRequestCount += count;
+	}
 
-	/// @brief Returns a handle to the I/O component
-	auto handle() const -> const Handle &
+	/// @brief Returns the limits the I/O component imposes on a single write request
+	auto writeLimits() const noexcept -> const WriteLimits &
 	{
-		return _handle;
+		return _writeLimits;
 	}
 
 	/// @name Virtual Overrides for skill::Element
@@ -70,8 +150,43 @@ private:
 
 	/// @}
 
-	/// @brief A handle to the I/O component
-	Handle _handle;
+	/// @brief Gets the sessions as connections for the I/O worker
+	auto connections() const -> std::vector<AbstractIoConnection *>;
+
+	/// @brief The sessions with the I/O component
+	std::vector<std::unique_ptr<TemplateIoSession>> _sessions;
+	/// @brief A counter used to select the session for the next request if several sessions are equally busy
+	std::atomic<std::size_t> _nextSession { 0 };
+
+	/// @brief The limits for read commands
+	ReadLimits _readLimits;
+	/// @brief The limits for write requests
+	WriteLimits _writeLimits;
+
+	/// @brief Whether the transactions should execute their commands using an I/O worker
+	bool _useIoWorker { true };
+	/// @brief The shared I/O worker group to use, or std::nullopt to use a dedicated I/O worker
+	std::optional<std::size_t> _ioWorkerGroup;
+	/// @brief The maximum number of requests that can be in flight on each session at the same time
+	std::size_t _pipelineDepth { 1 };
+	/// @brief The weights used to share the I/O worker between the Normal and Bulk priority classes
+	IoPriorityWeights _priorityWeights;
+	/// @brief The CPU affinity, scheduling policy, and name of the dedicated I/O worker thread, or of the thread of the worker group
+	ThreadOptions _threadOptions;
+	/// @brief The statistics about the time requests wait in the queue of the I/O worker
+	IoQueueStatistics _ioQueueStatistics;
+	/// @brief The counters of all the transactions of the component
+	IoCounters _counters;
+	/// @brief The total number of requests the transactions can submit to the I/O worker at the same time
+	std::size_t _ioRequestCount { 0 };
+	/// @brief The dedicated thread that executes the commands of the transactions, if no shared worker group is used
+	IoWorker _ioWorker;
+	/// @brief The shared I/O workers of the skill
+	std::reference_wrapper<IoWorkerGroups> _ioWorkerGroups;
+	/// @brief The decode pool of the skill
+	std::reference_wrapper<DecodePool> _decodePool;
+	/// @brief The I/O worker in use, or nullptr if none is used
+	IoWorker *_activeIoWorker { nullptr };
 };
 
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
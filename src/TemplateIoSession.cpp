@@ -0,0 +1,51 @@
+// Copyright (c) embedded ocean GmbH
+#include "TemplateIoSession.hpp"
+
+namespace xentara::plugins::templateDriver
+{
+
+auto TemplateIoSession::open() -> void
+{
+	/// @todo open the handle for the session
+
+	/// @todo if the open function does not throw errors, but uses return types or internal handle state,
+	// throw an std::system_error here on failure.
+
+	// The I/O worker starts counting the requests at 0 again once the session has been opened
+	_nextRequestId = 0;
+	_nextResponseId = 0;
+}
+
+auto TemplateIoSession::close() noexcept -> void
+{
+	/// @todo close the handle of the session
+}
+
+auto TemplateIoSession::pollHandle() const noexcept -> int
+{
+	/// @todo return the file descriptor of the socket or device the session receives responses from, so that the I/O worker
+	/// can wait for several sessions and I/O components at the same time, and set kHasPollHandle to true. Return -1 if there
+	/// is no such file descriptor.
+
+	return -1;
+}
+
+auto TemplateIoSession::receiveResponseId() -> std::uint32_t
+{
+	/// @todo receive the header of the next response. If the protocol has request IDs, return the ID the response contains,
+	/// which is the ID that was passed to TemplateIoTransaction::sendRequest().
+
+	/// @todo if the receive function does not throw errors, but uses return types or internal handle state,
+	// throw an std::system_error here on failure, and set _nextResponseId back to 0 before throwing.
+
+	// If the protocol has no request IDs, the responses arrive in the order the requests were sent, and the I/O worker
+	// numbers the requests of each session consecutively, so the running count of the responses is the request ID.
+	return _nextResponseId++;
+}
+
+auto TemplateIoSession::skipResponse() -> void
+{
+	/// @todo receive and discard the rest of the response whose header was just received
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,107 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "AbstractIoConnection.hpp"
+
+#include <xentara/utils/tools/Unique.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief A single session with an I/O component
+///
+/// An I/O component can have several sessions, if the I/O component processes the requests of different sessions in parallel.
+/// Each session has its own handle, and the requests are distributed over the sessions.
+/// @todo rename this class to something more descriptive, e.g. "TemplateConnection"
+class TemplateIoSession final : public AbstractIoConnection, private utils::tools::Unique
+{
+public:
+	/// @brief Whether pollHandle() returns a file descriptor once the session has been opened
+	///
+	/// Only I/O components whose sessions have a poll handle can be assigned to a shared I/O worker group.
+	/// @todo set this to true once pollHandle() returns the file descriptor of the session
+	static constexpr bool kHasPollHandle = false;
+
+	/// @brief A handle used to access the session
+	/// @todo implement a proper handle
+	class Handle final : private utils::tools::Unique
+	{
+	};
+
+	/// @brief Returns the handle of the session
+	auto handle() const -> const Handle &
+	{
+		return _handle;
+	}
+
+	/// @brief Opens the session
+	/// @throw std::system_error The session could not be opened
+	auto open() -> void;
+
+	/// @brief Closes the session
+	auto close() noexcept -> void;
+
+	/// @brief Returns the ID to send the next request with, if the request is executed directly, without the I/O worker
+	///
+	/// The requests are numbered consecutively, starting at 0 when the session is opened, like the I/O worker does.
+	/// Call requestSent() once the request has been sent, so that the ID of a request that could not be sent is used again.
+	auto nextRequestId() const noexcept -> std::uint32_t
+	{
+		return _nextRequestId;
+	}
+
+	/// @brief Records that the request with the ID returned by nextRequestId() was sent
+	auto requestSent() noexcept -> void
+	{
+		++_nextRequestId;
+	}
+
+	/// @brief Records that a request for this session was handed to the I/O worker
+	auto beginRequest() noexcept -> void
+	{
+		_outstandingRequests.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/// @brief Records that a request for this session handed to the I/O worker has completed
+	auto endRequest() noexcept -> void
+	{
+		_outstandingRequests.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	/// @brief Gets the number of requests for this session that were handed to the I/O worker and have not completed yet
+	///
+	/// This includes the requests still queued in the I/O worker, as well as the requests in flight.
+	auto outstandingRequests() const noexcept -> std::size_t
+	{
+		return _outstandingRequests.load(std::memory_order_relaxed);
+	}
+
+	/// @name Virtual Overrides for AbstractIoConnection
+	/// @{
+
+	auto pollHandle() const noexcept -> int final;
+
+	auto receiveResponseId() -> std::uint32_t final;
+
+	auto skipResponse() -> void final;
+
+	/// @}
+
+private:
+	/// @brief The handle of the session
+	Handle _handle;
+
+	/// @brief The ID of the next request executed without the I/O worker
+	std::uint32_t _nextRequestId { 0 };
+	/// @brief The ID of the next response, for protocols that do not carry request IDs
+	std::uint32_t _nextResponseId { 0 };
+
+	/// @brief The number of requests handed to the I/O worker that have not completed yet
+	std::atomic<std::size_t> _outstandingRequests { 0 };
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -2,10 +2,12 @@
 #include "TemplateIoTransaction.hpp"
 
 #include "Attributes.hpp"
+#include "ReadPlanner.hpp"
 #include "Tasks.hpp"
+#include "TemplateIoComponent.hpp"
 #include "TemplateInput.hpp"
 #include "TemplateOutput.hpp"
-#include "WriteCommand.hpp"
+#include "Tracepoints.hpp"
 
 #include <xentara/config/Context.hpp>
 #include <xentara/config/Errors.hpp>
@@ -22,6 +24,14 @@
 #include <xentara/utils/json/decoder/Errors.hpp>
 #include <xentara/utils/eh/currentErrorCode.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
 namespace xentara::plugins::templateDriver
 {
 
@@ -53,8 +63,73 @@ auto TemplateIoTransaction::load(utils::json::decoder::Object &jsonObject, confi
 	// Go through all the members of the JSON object that represents this object
 	for (auto && [name, value] : jsonObject)
     {
+		if (name == "pipelinedRead"sv)
+		{
+			_pipelinedRead = value.asBool();
+		}
+		else if (name == "priority"sv)
+		{
+			_priority = loadIoPriority(value);
+		}
+		else if (name == "requestRetries"sv)
+		{
+			_requestRetries = value.asNumber<std::size_t>();
+		}
+		else if (name == "requestTimeout"sv)
+		{
+			_requestTimeout = std::chrono::milliseconds(value.asNumber<std::chrono::milliseconds::rep>());
+			if (_requestTimeout <= std::chrono::milliseconds::zero())
+			{
+				/// @todo replace "template I/O transaction" with a more descriptive name
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("request timeout of template I/O transaction must be positive"));
+			}
+		}
+		else if (name == "decodeThreads"sv)
+		{
+			_decodeThreads = value.asNumber<std::size_t>();
+			if (_decodeThreads == 0)
+			{
+				/// @todo replace "template I/O transaction" with a more descriptive name
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("number of decode threads of template I/O transaction must not be zero"));
+			}
+		}
+		else if (name == "maxReadGap"sv)
+		{
+			_readCostModel._maxGap = value.asNumber<std::size_t>();
+		}
+		else if (name == "readCommandCost"sv)
+		{
+			_readCostModel._commandCost = value.asNumber<double>();
+			// Use a negated comparison, so that NaN is rejected, too
+			if (!(_readCostModel._commandCost >= 0))
+			{
+				/// @todo replace "template I/O transaction" with a more descriptive name
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("read command cost of template I/O transaction must not be negative"));
+			}
+		}
+		else if (name == "readByteCost"sv)
+		{
+			_readCostModel._byteCost = value.asNumber<double>();
+			// Use a negated comparison, so that NaN is rejected, too
+			if (!(_readCostModel._byteCost >= 0))
+			{
+				/// @todo replace "template I/O transaction" with a more descriptive name
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("read byte cost of template I/O transaction must not be negative"));
+			}
+		}
+		else if (name == "readPeriod"sv || name == "writePeriod"sv || name == "exchangePeriod"sv)
+		{
+			const std::chrono::milliseconds period(value.asNumber<std::chrono::milliseconds::rep>());
+			if (period <= std::chrono::milliseconds::zero())
+			{
+				/// @todo replace "template I/O transaction" with a more descriptive name
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("task period of template I/O transaction must be positive"));
+			}
+			auto &overruns = name == "readPeriod"sv ? _readOverruns : name == "writePeriod"sv ? _writeOverruns : _exchangeOverruns;
+			overruns.setPeriod(period);
+		}
 		/// @todo load configuration parameters
-		if (name == "TODO"sv)
+		else if (name == "TODO"sv)
 		{
 			/// @todo parse the value correctly
 			auto todo = value.asNumber<std::uint64_t>();
@@ -114,7 +189,18 @@ auto TemplateIoTransaction::forEachAttribute(const model::ForEachAttributeFuncti
 		// Handle the read state attributes
 		_readState.forEachAttribute(function) ||
 		// Handle the write state attributes
-		_writeState.forEachAttribute(function);
+		_writeState.forEachAttribute(function) ||
+		// Handle the read plan attributes
+		function(attributes::kReadCommandCount) ||
+		function(attributes::kUnusedReadBytes) ||
+		// Handle the timing statistics attributes
+		_timingStatistics.forEachAttribute(function) ||
+		// Handle the counter attributes
+		_counters.forEachAttribute(function) ||
+		// Handle the overrun attributes
+		_readOverruns.forEachAttribute(function) ||
+		_writeOverruns.forEachAttribute(function) ||
+		_exchangeOverruns.forEachAttribute(function);
 
 	/// @todo handle any additional attributes this class supports, including attributes inherited from the I/O component
 }
@@ -125,7 +211,11 @@ auto TemplateIoTransaction::forEachEvent(const model::ForEachEventFunction &func
 		// Handle the read state events
 		_readState.forEachEvent(function, sharedFromThis()) ||
 		// Handle the write state events
-		_writeState.forEachEvent(function, sharedFromThis());
+		_writeState.forEachEvent(function, sharedFromThis()) ||
+		// Handle the overrun events
+		_readOverruns.forEachEvent(function, sharedFromThis()) ||
+		_writeOverruns.forEachEvent(function, sharedFromThis()) ||
+		_exchangeOverruns.forEachEvent(function, sharedFromThis());
 
 	/// @todo handle any additional events this class supports, including events inherited from the I/O component
 }
@@ -135,7 +225,8 @@ auto TemplateIoTransaction::forEachTask(const model::ForEachTaskFunction &functi
 	// Handle all the tasks we support
 	return
 		function(tasks::kRead, sharedFromThis(&_readTask)) ||
-		function(tasks::kWrite, sharedFromThis(&_writeTask));
+		function(tasks::kWrite, sharedFromThis(&_writeTask)) ||
+		function(tasks::kExchange, sharedFromThis(&_exchangeTask));
 
 	/// @todo handle any additional tasks this class supports
 }
@@ -152,12 +243,57 @@ auto TemplateIoTransaction::makeReadHandle(const model::Attribute &attribute) co
 	{
 		return handle;
 	}
+	// Handle the read plan attributes
+	if (attribute == attributes::kReadCommandCount)
+	{
+		return data::ReadHandle { _readPlanStatistics._commandCount };
+	}
+	if (attribute == attributes::kUnusedReadBytes)
+	{
+		return data::ReadHandle { _readPlanStatistics._unusedBytes };
+	}
+	// Handle the timing statistics attributes
+	if (auto handle = _timingStatistics.makeReadHandle(attribute))
+	{
+		return handle;
+	}
+	// Handle the counter attributes
+	if (auto handle = _counters.makeReadHandle(attribute))
+	{
+		return handle;
+	}
+	// Handle the overrun attributes
+	if (auto handle = _readOverruns.makeReadHandle(attribute))
+	{
+		return handle;
+	}
+	if (auto handle = _writeOverruns.makeReadHandle(attribute))
+	{
+		return handle;
+	}
+	if (auto handle = _exchangeOverruns.makeReadHandle(attribute))
+	{
+		return handle;
+	}
 
 	/// @todo handle any additional readable attributes this class supports, including attributes inherited from the I/O component
 
 	return std::nullopt;
 }
 
+auto TemplateIoTransaction::makeWriteHandle(const model::Attribute &attribute) noexcept -> std::optional<data::WriteHandle>
+{
+	// Handle the timing statistics attributes
+	if (auto handle = _timingStatistics.makeWriteHandle(attribute, sharedFromThis()))
+	{
+		return handle;
+	}
+
+	/// @todo handle any additional writable attributes this class supports
+
+	return std::nullopt;
+}
+
 auto TemplateIoTransaction::forEachReadStateAttribute(const model::ForEachAttributeFunction &function) const -> bool
 {
 	return _readState.forEachAttribute(function);
@@ -168,9 +304,14 @@ auto TemplateIoTransaction::forEachReadStateEvent(const model::ForEachEventFunct
 	return _readState.forEachEvent(function, sharedFromThis());
 }
 
-auto TemplateIoTransaction::makeReadStateReadHandle(const model::Attribute &attribute) const noexcept
+auto TemplateIoTransaction::makeReadStateReadHandle(const ReadOperation *operation, const model::Attribute &attribute) const noexcept
 	-> std::optional<data::ReadHandle>
 {
+	// Use the read state of the operation, if there is one
+	if (operation)
+	{
+		return operation->readState().makeReadHandle(_readDataBlock, attribute);
+	}
 	return _readState.makeReadHandle(_readDataBlock, attribute);
 }
 
@@ -183,158 +324,988 @@ auto TemplateIoTransaction::realize() -> void
 	// Add our own states
 	_readState.attach(_readDataArray, readEventCount);
 	_writeState.attach(_writeDataArray, writeEventCount);
+	_readOverruns.attach(readEventCount);
+	_writeOverruns.attach(writeEventCount);
+	_exchangeOverruns.attach(readEventCount);
 
-	// Attach all the inputs
+	// Split the inputs into read commands the I/O component can handle
+	std::vector<ReadItem> readItems;
+	readItems.reserve(_inputs.size());
 	for (auto &&input : _inputs)
 	{
-		input.get().attachInput(_readDataArray, readEventCount);
+		const auto &address = input.get().dataAddress();
+		readItems.push_back({ address._address, address._size, input.get().valueTypeIndex() });
+	}
+	const auto plannedReads = planReads(readItems, _ioComponent.get().readLimits(), _readCostModel);
+
+	// Record the statistics of the plan
+	std::uint64_t unusedBytes { 0 };
+	_readSize = 0;
+	for (auto &&plannedRead : plannedReads)
+	{
+		unusedBytes += plannedRead._unusedSize;
+		_readSize += plannedRead._size;
+	}
+	_readPlanStatistics._commandCount = plannedReads.size();
+	_readPlanStatistics._unusedBytes = unusedBytes;
+
+	// Create the read operations, and attach them together with their inputs
+	_readOperations.clear();
+	_readOperations.reserve(plannedReads.size());
+	for (auto &&plannedRead : plannedReads)
+	{
+		auto &operation = *_readOperations.emplace_back(std::make_unique<ReadOperation>(plannedRead._address, plannedRead._size));
+		operation.attach(_readDataArray);
+
+		for (auto index : plannedRead._items)
+		{
+			auto &input = _inputs[index].get();
+			input.attachInput(_readDataArray, readEventCount);
+			input.addToReadOperation(operation);
+		}
+	}
+	// Attach all the outputs, giving each one its own bit in the pending output set. Outputs that must be written
+	// immediately also get their own immediate write object, so they can trigger the write.
+	_pendingOutputs.reset(_outputs.size());
+	_immediateWrites.clear();
+	for (std::size_t index = 0; index < _outputs.size(); ++index)
+	{
+		auto &output = _outputs[index].get();
+		ImmediateWrite *immediateWrite { nullptr };
+		if (output.immediateWrite())
+		{
+			immediateWrite = _immediateWrites.emplace_back(std::make_unique<ImmediateWrite>(*this, output)).get();
+			immediateWrite->_retryMarker = _pendingOutputs.marker(index);
+		}
+		output.attachOutput(_writeDataArray, writeEventCount, _pendingOutputs.marker(index, immediateWrite));
 	}
-	// Attach all the outputs
+
+	// Allocate the write command for the case that all outputs are written at once
+	std::size_t writeDataSize { 0 };
 	for (auto &&output : _outputs)
 	{
-		output.get().attachOutput(_writeDataArray, writeEventCount);
+		const auto size = output.get().dataAddress()._size;
+		if (size > _ioComponent.get().writeLimits()._maxSize)
+		{
+			/// @todo replace "template data point" and "template I/O component" with more descriptive names
+			throw std::runtime_error("template data point is larger than the maximum write size of the template I/O component");
+		}
+		writeDataSize += size;
+	}
+	_writeCommand.reset(_outputs.size(), writeDataSize);
+	_exchangeWriteCommand.reset(_outputs.size(), writeDataSize);
+
+	// Allocate the buffers for the immediate writes, which only ever write a single output
+	for (auto &&immediateWrite : _immediateWrites)
+	{
+		immediateWrite->_command.reset(1, immediateWrite->_output.get().dataAddress()._size);
+		immediateWrite->_outputsToNotify.reset(1);
+		immediateWrite->_requests.reset(*this, 1, &immediateWrite->_command);
 	}
 
+	// Allocate the requests for the I/O worker. Each task needs one request per command it can send in a single cycle,
+	// and each immediate write needs a single request.
+	_readRequests.reset(*this, _readOperations.size());
+	_writeRequests.reset(*this, _outputs.size(), &_writeCommand);
+	_exchangeRequests.reset(*this, std::max(_readOperations.size(), _outputs.size()), &_exchangeWriteCommand);
+	_ioComponent.get().reserveIoRequests(_readRequests._requests.size() + _writeRequests._requests.size() +
+		_exchangeRequests._requests.size() + _immediateWrites.size());
+
 	// Create the data blocks
 	_readDataBlock.create(memory::memoryResources::data());
 	_writeDataBlock.create(memory::memoryResources::data());
 
 	// Reserve space in the buffers
-	_runtimeBuffers._eventsToRaise.reset(std::max(readEventCount, writeEventCount));
+	_runtimeBuffers._eventsToRaise.reset(readEventCount);
+	_runtimeBuffers._decodeEventsToRaise = std::make_unique<PendingEventList[]>(_decodeThreads - 1);
+	for (std::size_t index = 0; index + 1 < _decodeThreads; ++index)
+	{
+		_runtimeBuffers._decodeEventsToRaise[index].reset(readEventCount);
+	}
+	_runtimeBuffers._readPhaseTimes = std::make_unique<ReadPhaseTimes[]>(_decodeThreads);
+	_runtimeBuffers._writeEventsToRaise.reset(writeEventCount);
 	_runtimeBuffers._outputsToNotify.reset(_outputs.size());
+	_runtimeBuffers._exchangeOutputsToNotify.reset(_outputs.size());
 }
 
 auto TemplateIoTransaction::prepare() -> void
 {
-	// Create a read command
-	/// @todo initialized the read command properly based on the inputs to read.
-	_readCommand.reset(new ReadCommand);
+	// Prepare the decoding for all the read operations
+	for (auto &&operation : _readOperations)
+	{
+		operation->prepare();
+	}
+
+	// Collect the chunks of inputs of all the operations, so that the decode threads can divide them among themselves
+	_decodeChunks.clear();
+	if (_decodeThreads > 1)
+	{
+		for (auto &&operation : _readOperations)
+		{
+			for (std::size_t chunk = 0; chunk < operation->chunkCount(); ++chunk)
+			{
+				_decodeChunks.push_back({ *operation, chunk });
+			}
+		}
+	}
+
+	// Measure the rate of the clock used for the read phases now, so that the first read is not delayed
+	CycleClock::secondsPerTick();
+
+	// Make sure the decode pool has enough threads
+	if (_decodeThreads > 1)
+	{
+		_ioComponent.get().decodePool().acquire(_decodeThreads - 1);
+	}
+}
+
+auto TemplateIoTransaction::cleanup() -> void
+{
+	// Wait for any immediate writes that are still in progress, because they use our buffers
+	for (auto &&immediateWrite : _immediateWrites)
+	{
+		awaitRequests(immediateWrite->_requests);
+	}
 
-	/// @todo provide the information needed to decode the value to the inputs, like e.g. the correct data data offsets.
+	if (_decodeThreads > 1)
+	{
+		_ioComponent.get().decodePool().release();
+	}
 }
 
 auto TemplateIoTransaction::performReadTask(const process::ExecutionContext &context) -> void
 {
-	read(context.scheduledTime());
+	// Don't interfere with the reads of the polling group
+	if (_pollingGroup)
+	{
+		return;
+	}
+
+	_timingStatistics.recordStartLag(context.scheduledTime());
+	_readOverruns.startCycle(context.scheduledTime());
+	const auto startTime = std::chrono::steady_clock::now();
+
+	// Use the correct read mode
+	if (_pipelinedRead)
+	{
+		readPipelined(context.scheduledTime());
+	}
+	else
+	{
+		read(context.scheduledTime());
+	}
+
+	_timingStatistics.recordReadDuration(std::chrono::steady_clock::now() - startTime);
+	_readOverruns.finishCycle();
 }
 
 auto TemplateIoTransaction::read(std::chrono::system_clock::time_point timeStamp) -> void
 {
+	TEMPLATE_DRIVER_TRACE_SCOPE(read, this, _inputs.size(), _readSize);
+
+	auto &phaseTimes = _runtimeBuffers._readPhaseTimes[0];
+	auto phaseStart = CycleClock::now();
+
+	// Execute all the read commands, and wait for them to complete
+	for (auto &&operation : _readOperations)
+	{
+		submitRequest(_readRequests, nullptr, operation.get(), _priority);
+	}
+	phaseTimes.lap(ReadPhase::Submit, phaseStart);
+	awaitRequests(_readRequests);
+	phaseTimes.lap(ReadPhase::Wait, phaseStart);
+
+	// Update all the inputs at once
+	countRead(updateInputs(timeStamp, &_readOverruns));
+}
+
+auto TemplateIoTransaction::readPipelined(std::chrono::system_clock::time_point timeStamp) -> void
+{
+	TEMPLATE_DRIVER_TRACE_SCOPE(read, this, _inputs.size(), _readSize);
+
+	// Collect the responses to the commands issued in the last cycle, and update the inputs. This is skipped in the first cycle,
+	// because there are no responses yet.
+	auto &phaseTimes = _runtimeBuffers._readPhaseTimes[0];
+	if (_pipelinedReadsIssued)
+	{
+		auto waitStart = CycleClock::now();
+		awaitRequests(_readRequests);
+		phaseTimes.lap(ReadPhase::Wait, waitStart);
+
+		// Update all the inputs at once. This must be done before issuing the next commands, because the payloads
+		// refer to the receive buffers of the commands.
+		countRead(updateInputs(timeStamp, &_readOverruns));
+	}
+
+	// Issue the commands for the next cycle, without waiting for them to complete. The time this takes is recorded
+	// together with the next update.
+	auto submitStart = CycleClock::now();
+	for (auto &&operation : _readOperations)
+	{
+		submitRequest(_readRequests, nullptr, operation.get(), _priority);
+	}
+	phaseTimes.lap(ReadPhase::Submit, submitStart);
+	_pipelinedReadsIssued = true;
+}
+
+auto TemplateIoTransaction::joinPollingGroup(const TemplatePollingGroup &group) -> void
+{
+	// The reads of two polling groups would interfere with each other
+	if (_pollingGroup && _pollingGroup != &group)
+	{
+		/// @todo replace "template I/O transaction" and "template polling group" with more descriptive names
+		throw std::runtime_error("template I/O transaction belongs to more than one template polling group");
+	}
+
+	_pollingGroup = &group;
+}
+
+auto TemplateIoTransaction::startGroupRead() noexcept -> void
+{
+	// Collect any commands of the last cycle that missed the deadline, without waiting. If they have still not completed,
+	// the I/O component is too slow to send any new commands.
+	_groupReadIssued = awaitRequests(_readRequests, std::chrono::steady_clock::now());
+	if (!_groupReadIssued)
+	{
+		return;
+	}
+
+	// Send the commands, without waiting for them to complete
+	auto submitStart = CycleClock::now();
+	for (auto &&operation : _readOperations)
+	{
+		submitRequest(_readRequests, nullptr, operation.get(), _priority);
+	}
+	_runtimeBuffers._readPhaseTimes[0].lap(ReadPhase::Submit, submitStart);
+}
+
+auto TemplateIoTransaction::finishGroupRead(
+	std::chrono::system_clock::time_point timeStamp, std::optional<std::chrono::steady_clock::time_point> deadline) -> void
+{
+	// Wait for the responses
+	auto waitStart = CycleClock::now();
+	auto completed = true;
+	if (deadline)
+	{
+		completed = awaitRequests(_readRequests, *deadline);
+	}
+	else
+	{
+		awaitRequests(_readRequests);
+	}
+	_runtimeBuffers._readPhaseTimes[0].lap(ReadPhase::Wait, waitStart);
+
+	// If the responses did not arrive in time, or no commands could be sent at all, report a timeout. The read operations
+	// must not be used then, because the I/O worker may still be writing to them. This is only counted as a timeout, not as
+	// a read, because the responses were not received.
+	if (!completed || !_groupReadIssued)
+	{
+		count(IoCounter::Timeouts);
+		updateInputs(timeStamp, nullptr, CustomError::Timeout);
+		return;
+	}
+
+	// Update all the inputs at once
+	countRead(updateInputs(timeStamp, nullptr));
+}
+
+auto TemplateIoTransaction::performWriteTask(const process::ExecutionContext &context) -> void
+{
+	_timingStatistics.recordStartLag(context.scheduledTime());
+
+	_writeOverruns.startCycle(context.scheduledTime());
+	write(context.scheduledTime(), _priority, &_writeOverruns);
+	_writeOverruns.finishCycle();
+}
+
+auto TemplateIoTransaction::write(std::chrono::system_clock::time_point timeStamp, IoPriority priority, OverrunMonitor *overruns) -> void
+{
+	// Protect use of the list of outputs to notify and of the write command
+	RuntimeBufferSentinel outputsToNotifySentinel(_runtimeBuffers._outputsToNotify);
+	RuntimeBufferSentinel writeCommandSentinel(_writeCommand);
+
+	const auto startTime = std::chrono::steady_clock::now();
+
+	// If there were no pending outputs, just bail
+	if (!collectPendingOutputs(_writeCommand, _runtimeBuffers._outputsToNotify))
+	{
+		return;
+	}
+
+	// Only writes that actually write something are traced, like they are only recorded in the timing statistics
+	TEMPLATE_DRIVER_TRACE_SCOPE(write, this, _runtimeBuffers._outputsToNotify.size(), _writeCommand.dataSize());
+
+	// Send the requests, and wait for them to complete
+	for (auto &&block : _writeCommand.blocks())
+	{
+		submitRequest(_writeRequests, &block, nullptr, priority);
+	}
+	awaitRequests(_writeRequests);
+
+	// Update the state
+	updateOutputs(timeStamp, _writeCommand, _runtimeBuffers._outputsToNotify, overruns);
+
+	// Only writes that actually wrote something are recorded, so that idle cycles do not distort the statistics
+	_timingStatistics.recordWriteDuration(std::chrono::steady_clock::now() - startTime);
+}
+
+auto TemplateIoTransaction::ImmediateWrite::writeImmediately() noexcept -> void
+{
+	// If a write is already in progress, it will write the new value once it is done
+	if (_markCount.fetch_add(1, std::memory_order_acq_rel) != 0)
+	{
+		return;
+	}
+
+	_transaction.startImmediateWrite(*this);
+}
+
+auto TemplateIoTransaction::startImmediateWrite(ImmediateWrite &write) noexcept -> void
+{
+	// Collect the completion of the last write. The coroutine of that write has already finished writing, so this never waits
+	// for any I/O, only for the coroutine to report its completion.
+	awaitRequests(write._requests);
+
+	auto &request = *write._requests._requests.front();
 	try
 	{
-		/// @todo send the read command
-		ReadCommand::Payload payload = {};
+		// Run the write in a coroutine, so that we do not have to wait for it
+		auto coroutine = performImmediateWrite(write, request);
+		++write._requests._submitted;
+		coroutine.start(write._requests._completions, request);
+	}
+	catch (const std::exception &)
+	{
+		// Have the next write cycle start the write again. The write itself is still performed by this object, so that
+		// the values of the output are written in order.
+		write._markCount.store(0, std::memory_order_release);
+		write._retryMarker.mark();
+	}
+}
+
+auto TemplateIoTransaction::performImmediateWrite(ImmediateWrite &write, IoRequest &request) -> IoCoroutine
+{
+	// Keep writing until all the marks have been handled
+	for (auto markCount = write._markCount.load(std::memory_order_acquire); markCount != 0;
+		markCount = write._markCount.fetch_sub(markCount, std::memory_order_acq_rel) - markCount)
+	{
+		try
+		{
+			// Protect use of the list of outputs to notify and of the write command
+			RuntimeBufferSentinel outputsToNotifySentinel(write._outputsToNotify);
+			RuntimeBufferSentinel writeCommandSentinel(write._command);
+
+			// Get the value. If it was already written by an earlier iteration, there is nothing to do.
+			if (!write._output.get().addToWriteCommand(write._command))
+			{
+				continue;
+			}
+			write._outputsToNotify.push_back(write._output);
+			write._command.plan(_ioComponent.get().writeLimits());
+
+			// Write the value with the highest priority, so that it does not have to wait for other requests, and repeat
+			// the request as often as configured if it fails, like performRequest() does
+			auto &block = write._command.blocks().front();
+			request.assign(&block, nullptr, IoPriority::Control);
+			auto error = co_await request;
+			for (auto retries = _requestRetries; error && retries > 0; --retries)
+			{
+				count(IoCounter::Retries);
+				error = co_await request;
+			}
+			if (error)
+			{
+				recordRequestError(&block, nullptr, error);
+			}
+
+			// Update the state
+			updateOutputs(std::chrono::system_clock::now(), write._command, write._outputsToNotify, nullptr);
+		}
+		catch (const std::exception &)
+		{
+			// The errors of the request itself are recorded in the write state, so this can only be a system error, like
+			// failing to lock the mutex. There is nothing more we can do about it here.
+		}
+	}
+}
+
+auto TemplateIoTransaction::collectPendingOutputs(WriteCommand &command, OutputList &outputs) -> bool
+{
+	// Collect the pending outputs. Only the outputs that were marked need to be checked.
+	_pendingOutputs.takeAll([&](std::size_t index)
+		{
+			const auto output = _outputs[index];
+
+			// Outputs that must be written immediately are only marked if their write could not be started, so start it again.
+			// Their values are never added to the command, so that they cannot overtake the values written immediately.
+			if (output.get().immediateWrite()) [[unlikely]]
+			{
+				const auto immediateWrite = std::ranges::find(_immediateWrites, &output.get(),
+					[](const std::unique_ptr<ImmediateWrite> &write) { return &write->_output.get(); });
+				if (immediateWrite != _immediateWrites.end())
+				{
+					(*immediateWrite)->writeImmediately();
+				}
+				return;
+			}
+
+			// Add the output
+			if (output.get().addToWriteCommand(command))
+			{
+				outputs.push_back(output);
+			}
+		});
+
+	// Check if there were any pending outputs
+	if (outputs.empty())
+	{
+		return false;
+	}
 
-		/// @todo if the read function does not throw errors, but uses return types or internal handle state,
-		// throw an std::system_error here on failure, or call updateInputs() directly.
+	// Merge outputs with adjacent addresses into as few write requests as possible
+	command.plan(_ioComponent.get().writeLimits());
 
-		// The read was successful
-		updateInputs(timeStamp, payload);
+	return true;
+}
+
+auto TemplateIoTransaction::performExchangeTask(const process::ExecutionContext &context) -> void
+{
+	// Don't interfere with the reads of the polling group
+	if (_pollingGroup)
+	{
+		return;
+	}
+
+	_timingStatistics.recordStartLag(context.scheduledTime());
+	// The exchange task reads all the inputs, so it is recorded as a read in the timing statistics
+	_exchangeOverruns.startCycle(context.scheduledTime());
+	const auto startTime = std::chrono::steady_clock::now();
+
+	exchange(context.scheduledTime());
+
+	_timingStatistics.recordReadDuration(std::chrono::steady_clock::now() - startTime);
+	_exchangeOverruns.finishCycle();
+}
+
+auto TemplateIoTransaction::exchange(std::chrono::system_clock::time_point timeStamp) -> void
+{
+	// Protect use of the list of outputs to notify and of the write command. The "exchange" task has its own, so that it does
+	// not have to lock out the "write" task or immediate writes while it is reading.
+	RuntimeBufferSentinel outputsToNotifySentinel(_runtimeBuffers._exchangeOutputsToNotify);
+	RuntimeBufferSentinel writeCommandSentinel(_exchangeWriteCommand);
+
+	auto &phaseTimes = _runtimeBuffers._readPhaseTimes[0];
+	auto phaseStart = CycleClock::now();
+
+	// Collect the pending outputs. The blocks will be empty if there are none.
+	const auto hasOutputs = collectPendingOutputs(_exchangeWriteCommand, _runtimeBuffers._exchangeOutputsToNotify);
+	const auto blocks = _exchangeWriteCommand.blocks();
+
+	// Pair each write request with a read command, so that each pair only needs a single round trip. If there are more
+	// write requests than read commands or vice versa, the remaining ones are sent on their own.
+	const auto commandCount = std::max(blocks.size(), _readOperations.size());
+	for (std::size_t index = 0; index < commandCount; ++index)
+	{
+		auto *block = index < blocks.size() ? &blocks[index] : nullptr;
+		auto *operation = index < _readOperations.size() ? _readOperations[index].get() : nullptr;
+		submitRequest(_exchangeRequests, block, operation, _priority);
+	}
+	phaseTimes.lap(ReadPhase::Submit, phaseStart);
+	awaitRequests(_exchangeRequests);
+	phaseTimes.lap(ReadPhase::Wait, phaseStart);
+
+	// Update the outputs, if we wrote any
+	if (hasOutputs)
+	{
+		updateOutputs(timeStamp, _exchangeWriteCommand, _runtimeBuffers._exchangeOutputsToNotify, nullptr);
+	}
+	// Update all the inputs at once
+	countRead(updateInputs(timeStamp, &_exchangeOverruns));
+}
+
+auto TemplateIoTransaction::executeRequest(
+	TemplateIoSession &session, const WriteCommand *command, WriteCommand::Block *block, ReadOperation *operation) noexcept -> std::error_code
+{
+	/// @todo apply _requestTimeout to sending the request and receiving the response, and throw an std::system_error with
+	/// CustomError::Timeout if it expires. Without the I/O worker, the request timeout can only be enforced by the session handle.
+
+	try
+	{
+		// Send the request, and receive the response right away
+		const auto requestId = session.nextRequestId();
+		sendRequest(session, command, block, operation, requestId);
+		session.requestSent();
+		if (session.receiveResponseId() != requestId)
+		{
+			throw std::system_error(CustomError::UnexpectedResponse);
+		}
+		receiveResponse(session, block, operation);
 	}
 	catch (const std::exception &)
 	{
 		// Get the error from the current exception using this special utility function
-		const auto error = utils::eh::currentErrorCode();
-		// Update the state
-		updateInputs(timeStamp, utils::eh::unexpected(error));
+		return utils::eh::currentErrorCode();
 	}
+
+	return {};
 }
 
-auto TemplateIoTransaction::performWriteTask(const process::ExecutionContext &context) -> void
+auto TemplateIoTransaction::performRequest(IoRequest &request) -> IoCoroutine
 {
-	write(context.scheduledTime());
+	// Execute the request, and repeat it as often as configured if it fails
+	auto error = co_await request;
+	for (auto retries = _requestRetries; error && retries > 0; --retries)
+	{
+		count(IoCounter::Retries);
+		error = co_await request;
+	}
+
+	// Record the error of the last attempt. The results of successful requests have already been recorded by receiveResponse().
+	if (error)
+	{
+		recordRequestError(request.block(), request.operation(), error);
+	}
 }
 
-auto TemplateIoTransaction::write(std::chrono::system_clock::time_point timeStamp) -> void
+auto TemplateIoTransaction::sendRequest([[maybe_unused]] TemplateIoSession &session,
+	[[maybe_unused]] const WriteCommand *command,
+	[[maybe_unused]] const WriteCommand::Block *block,
+	[[maybe_unused]] ReadOperation *operation,
+	[[maybe_unused]] std::uint32_t requestId) -> void
 {
-	// Protect use of the list of outputs to notify
-	RuntimeBufferSentinel eventsToRaiseSentinel(_runtimeBuffers._outputsToNotify);
+	TEMPLATE_DRIVER_TRACE_SCOPE(send, this,
+		(block ? block->_entryCount : 0) + (operation ? operation->batches().size() : 0),
+		(block ? block->_size : 0) + (operation ? operation->command().size() : 0));
 
-	// Create a command
-	WriteCommand command;
+	/// @todo send a request tagged with requestId over session.handle(), so that the response can be matched to it. The request consists of:
+	/// - a write request for command->data(*block) starting at block->_address, if block is not nullptr. If the I/O component
+	///   has a separate request for writing a single value, use it if block->_entryCount is 1.
+	/// - the read command operation->command(), if operation is not nullptr.
+	/// If both are present, send a combined command that first writes and then reads, if the I/O component supports it. Otherwise,
+	/// send the write request and the read command back to back, without waiting for the first response in between.
 
-	// Collect pending outputs
-	for (auto &&output : _outputs)
+	/// @todo if the send function does not throw errors, but uses return types or internal handle state,
+	// throw an std::system_error here on failure.
+
+	// The number of bytes actually sent, including the headers, the read command, and any protocol overhead
+	/// @todo add the size of everything sent over session.handle() for this request
+	std::size_t sentSize { 0 };
+	count(IoCounter::BytesSent, sentSize);
+}
+
+auto TemplateIoTransaction::receiveResponse([[maybe_unused]] TemplateIoSession &session, WriteCommand::Block *block, ReadOperation *operation)
+	-> void
+{
+	TEMPLATE_DRIVER_TRACE_SCOPE(receive, this,
+		(block ? block->_entryCount : 0) + (operation ? operation->batches().size() : 0), operation ? operation->command().size() : 0);
+
+	/// @todo receive the rest of the response from session.handle(). Any read data must be received directly into operation->command().receiveBuffer().
+	/// The payload refers to the receive buffer, so the data must not be copied anywhere else.
+
+	/// @todo if the receive function does not throw errors, but uses return types or internal handle state,
+	// throw an std::system_error here on failure, or if the response reports an error.
+
+	// The number of bytes actually received for the response, including the header received by TemplateIoSession::receiveResponseId()
+	// and any protocol overhead
+	/// @todo add the size of everything received from session.handle() for this response
+	std::size_t receivedSize { 0 };
+	count(IoCounter::BytesReceived, receivedSize);
+
+	// Record the result of the read part
+	if (operation)
 	{
-		// Add the output
-		if (output.get().addToWriteCommand(command))
+		auto &command = operation->command();
+
+		/// @todo set this to the number of bytes of read data actually received into the receive buffer
+		const std::size_t payloadSize = command.size();
+
+		// Make sure that we received the data for all the inputs
+		const auto payload = command.payload(payloadSize);
+		if (payload.size() < command.size())
 		{
-			_runtimeBuffers._outputsToNotify.push_back(output);
+			throw std::system_error(CustomError::IncompleteResponse);
 		}
+
+		operation->setPayload(payload);
 	}
 
-	// If there were no pending outputs, just bail
-	if (_runtimeBuffers._outputsToNotify.empty())
+	// Record the success of the write part
+	if (block)
 	{
-		return;
+		block->_error.clear();
+	}
+}
+
+auto TemplateIoTransaction::recordRequestError(WriteCommand::Block *block, ReadOperation *operation, std::error_code error) noexcept -> void
+{
+	if (block)
+	{
+		block->_error = error;
+	}
+	if (operation)
+	{
+		operation->setError(error);
 	}
+}
 
+auto TemplateIoTransaction::submitRequest(IoRequestSet &requests, WriteCommand::Block *block, ReadOperation *operation, IoPriority priority) noexcept
+	-> void
+{
+	auto &request = *requests._requests[requests._submitted];
+	request.assign(block, operation, priority);
+	if (operation)
+	{
+		count(IoCounter::ReadCommands);
+	}
 	try
 	{
-		/// @todo send the command
+		// Run the request in a coroutine. The coroutine reports its completion in the completion ring once it has finished.
+		auto coroutine = performRequest(request);
+		++requests._submitted;
+		coroutine.start(requests._completions, request);
+	}
+	catch (const std::exception &)
+	{
+		// Get the error from the current exception using this special utility function
+		recordRequestError(block, operation, utils::eh::currentErrorCode());
+	}
+}
+
+auto TemplateIoTransaction::awaitRequests(IoRequestSet &requests) noexcept -> void
+{
+	for (; requests._submitted > 0; --requests._submitted)
+	{
+		requests._completions.wait();
+	}
+}
+
+auto TemplateIoTransaction::awaitRequests(IoRequestSet &requests, std::chrono::steady_clock::time_point deadline) noexcept -> bool
+{
+	for (; requests._submitted > 0; --requests._submitted)
+	{
+		if (!requests._completions.waitUntil(deadline))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+auto TemplateIoTransaction::count(IoCounter counter, std::uint64_t amount) noexcept -> void
+{
+	_counters.add(counter, amount);
+	_ioComponent.get().counters().add(counter, amount);
+}
+
+auto TemplateIoTransaction::IoRequestSet::reset(TemplateIoTransaction &transaction, std::size_t count, const WriteCommand *command) -> void
+{
+	_requests.clear();
+	_requests.reserve(count);
+	for (std::size_t index = 0; index < count; ++index)
+	{
+		_requests.push_back(std::make_unique<IoRequest>(transaction, command));
+	}
+	_completions.reset(count);
+	_submitted = 0;
+}
 
-		/// @todo if the write function does not throw errors, but uses return types or internal handle state,
-		// throw an std::system_error here on failure, or call updateOutputs() directly.
+auto TemplateIoTransaction::IoRequest::await_suspend(std::coroutine_handle<> continuation) noexcept -> bool
+{
+	// Select the session for each attempt, so that a retry does not depend on the session that just failed
+	auto &ioComponent = _transaction._ioComponent.get();
+	_session = &ioComponent.nextSession();
 
-		// The write was successful
-		updateOutputs(timeStamp, std::error_code(), _runtimeBuffers._outputsToNotify);
+	// Execute the request directly if the I/O component has no I/O worker. The coroutine then continues without suspending.
+	auto *worker = ioComponent.ioWorker();
+	if (!worker)
+	{
+		_error = _transaction.executeRequest(*_session, _command, _block, _operation);
+		if (_error == CustomError::Timeout)
+		{
+			_transaction.count(IoCounter::Timeouts);
+		}
+		return false;
+	}
+
+	// Writes must not be held up by bulk polls, so requests that write use at least the Normal priority class.
+	// The classes are ordered by decreasing priority, so the higher priority has the lower value.
+	const auto priority = _block ? std::min(_priority, IoPriority::Normal) : _priority;
+
+	// Hand the request to the worker, which resumes the coroutine once the request has completed. This may happen before
+	// submit() even returns, so no members may be used after submitting.
+	// The attempt fails with a timeout if the response has not arrived in time, so that a lost response cannot hold up the
+	// task waiting for the request forever
+	const auto deadline = std::chrono::steady_clock::now() + _transaction._requestTimeout;
+
+	_continuation = continuation;
+	_session->beginRequest();
+	try
+	{
+		worker->submit(*this, priority, ioComponent.ioQueueStatistics(), deadline);
+		return true;
+	}
+	catch (const std::exception &)
+	{
+		_session->endRequest();
+
+		// Get the error from the current exception using this special utility function
+		_error = utils::eh::currentErrorCode();
+		return false;
+	}
+}
+
+auto TemplateIoTransaction::IoRequest::connection() noexcept -> AbstractIoConnection &
+{
+	return *_session;
+}
+
+auto TemplateIoTransaction::IoRequest::send(std::uint32_t requestId) noexcept -> bool
+{
+	try
+	{
+		_transaction.sendRequest(*_session, _command, _block, _operation, requestId);
+		return true;
+	}
+	catch (const std::exception &)
+	{
+		// Get the error from the current exception using this special utility function
+		fail(utils::eh::currentErrorCode());
+		return false;
+	}
+}
+
+auto TemplateIoTransaction::IoRequest::receive() noexcept -> void
+{
+	std::error_code error;
+	try
+	{
+		_transaction.receiveResponse(*_session, _block, _operation);
 	}
 	catch (const std::exception &)
 	{
 		// Get the error from the current exception using this special utility function
-		const auto error = utils::eh::currentErrorCode();
-		// Update the state
-		updateOutputs(timeStamp, error, _runtimeBuffers._outputsToNotify);
+		error = utils::eh::currentErrorCode();
 	}
+
+	complete(error);
+}
+
+auto TemplateIoTransaction::IoRequest::fail(std::error_code error) noexcept -> void
+{
+	complete(error);
+}
+
+auto TemplateIoTransaction::IoRequest::complete(std::error_code error) noexcept -> void
+{
+	_error = error;
+	_session->endRequest();
+	if (error == CustomError::Timeout)
+	{
+		_transaction.count(IoCounter::Timeouts);
+	}
+
+	// Resume the coroutine. It will either send the request again, or finish and report the completion.
+	std::exchange(_continuation, {}).resume();
 }
 
 auto TemplateIoTransaction::invalidateData(std::chrono::system_clock::time_point timeStamp) -> void
 {
-	// Set the state to "No Data"
-	updateInputs(timeStamp, utils::eh::unexpected(CustomError::NoData));
+	// The polling group invalidates the data itself
+	if (_pollingGroup)
+	{
+		return;
+	}
+
+	invalidateInputs(timeStamp);
+}
+
+auto TemplateIoTransaction::invalidateInputs(std::chrono::system_clock::time_point timeStamp) -> void
+{
+	// Wait for any pipelined reads to complete, because their responses are received into the buffers of the commands
+	awaitRequests(_readRequests);
+	_pipelinedReadsIssued = false;
+
+	// Set the state of all the read operations to "No Data"
+	for (auto &&operation : _readOperations)
+	{
+		operation->setError(CustomError::NoData);
+	}
+	updateInputs(timeStamp, nullptr);
 }
 
-auto TemplateIoTransaction::updateInputs(std::chrono::system_clock::time_point timeStamp, const utils::eh::expected<std::reference_wrapper<const ReadCommand::Payload>, std::error_code> &payloadOrError)
-	-> void
+auto TemplateIoTransaction::updateInputs(
+	std::chrono::system_clock::time_point timeStamp, OverrunMonitor *overruns, std::error_code error) -> std::error_code
 {
+	TEMPLATE_DRIVER_TRACE_SCOPE(update_inputs, this, _inputs.size(), _readSize);
+
 	// Protect use of the pending event buffer
 	RuntimeBufferSentinel eventsToRaiseSentinel(_runtimeBuffers._eventsToRaise);
 
 	// Make a write sentinel
 	memory::WriteSentinel sentinel { _readDataBlock };
 
-	// Update the common read state
-	const auto commonChanges = _readState.update(sentinel, timeStamp, payloadOrError.error(), _runtimeBuffers._eventsToRaise);
+	// Runs an update of inputs, counts the values that changed, and records the time spent
+	const auto measureUpdate = [&](ReadPhaseTimes &phaseTimes, auto &&update)
+		{
+			const auto updateStart = CycleClock::now();
+			const auto decodeTicks = phaseTimes[ReadPhase::Decode];
 
-	// Update all the inputs
-	for (auto &&input : _inputs)
+			const auto changedCount = update();
+			if (changedCount > 0)
+			{
+				count(IoCounter::InputsChanged, changedCount);
+			}
+
+			// The time not spent decoding was spent updating the read states
+			phaseTimes.add(ReadPhase::Update, CycleClock::now() - updateStart - (phaseTimes[ReadPhase::Decode] - decodeTicks));
+		};
+
+	// Update the inputs in parallel, if configured. The chunks write disjoint parts of the data block, and each thread
+	// collects its events in its own list. Chunks are ranges of inputs, so even the inputs of a single large read operation
+	// are divided between the threads.
+	if (_decodeThreads > 1 && _decodeChunks.size() > 1)
+	{
+		// Update the read states of the operations first, because the update of the inputs depends on them
+		for (auto &&operation : _readOperations)
+		{
+			if (error)
+			{
+				operation->beginUpdate(sentinel, timeStamp, error);
+			}
+			else
+			{
+				operation->beginUpdate(sentinel, timeStamp);
+			}
+		}
+
+		_ioComponent.get().decodePool().run(_decodeChunks.size(), _decodeThreads, [&](std::size_t index, std::size_t participant)
+			{
+				auto &eventsToRaise =
+					participant == 0 ? _runtimeBuffers._eventsToRaise : _runtimeBuffers._decodeEventsToRaise[participant - 1];
+				auto &phaseTimes = _runtimeBuffers._readPhaseTimes[participant];
+				const auto &[operation, chunk] = _decodeChunks[index];
+				measureUpdate(phaseTimes, [&] { return operation.get().updateChunk(chunk, sentinel, timeStamp, eventsToRaise, phaseTimes); });
+			});
+
+		// Merge the events collected by the pool threads
+		for (std::size_t index = 0; index + 1 < _decodeThreads; ++index)
+		{
+			RuntimeBufferSentinel decodeEventsToRaiseSentinel(_runtimeBuffers._decodeEventsToRaise[index]);
+			for (auto &&event : _runtimeBuffers._decodeEventsToRaise[index])
+			{
+				_runtimeBuffers._eventsToRaise.push_back(event);
+			}
+		}
+	}
+	else
+	{
+		auto &eventsToRaise = _runtimeBuffers._eventsToRaise;
+		auto &phaseTimes = _runtimeBuffers._readPhaseTimes[0];
+		for (auto &&operation : _readOperations)
+		{
+			// Use the error instead of the recorded result, if there is one
+			measureUpdate(phaseTimes, [&]
+				{
+					return error ?
+						operation->update(sentinel, timeStamp, error, eventsToRaise, phaseTimes) :
+						operation->update(sentinel, timeStamp, eventsToRaise, phaseTimes);
+				});
+		}
+	}
+
+	// Determine the first error for the combined state
+	auto firstError = error;
+	for (auto operation = _readOperations.begin(); !firstError && operation != _readOperations.end(); ++operation)
+	{
+		firstError = (*operation)->error();
+	}
+
+	// If there are no read operations, we have no data
+	if (_readOperations.empty())
 	{
-		input.get().updateReadState(sentinel, timeStamp, payloadOrError, commonChanges, _runtimeBuffers._eventsToRaise);
+		firstError = CustomError::NoData;
+	}
+
+	// Update the combined read state
+	_readState.update(sentinel, timeStamp, firstError, _runtimeBuffers._eventsToRaise);
+
+	// Check for an overrun of the task, so that the overrun event is raised together with the data
+	if (overruns)
+	{
+		overruns->check(_runtimeBuffers._eventsToRaise);
 	}
 
 	// Commit the data and raise the events
+	auto &phaseTimes = _runtimeBuffers._readPhaseTimes[0];
+	auto commitStart = CycleClock::now();
 	sentinel.commit(timeStamp, _runtimeBuffers._eventsToRaise);
+	phaseTimes.lap(ReadPhase::Commit, commitStart);
+
+	// Publish the phase times, including the time the decode pool threads spent decoding and updating
+	for (std::size_t index = 1; index < _decodeThreads; ++index)
+	{
+		phaseTimes += _runtimeBuffers._readPhaseTimes[index];
+		_runtimeBuffers._readPhaseTimes[index].clear();
+	}
+	_timingStatistics.recordReadPhases(phaseTimes);
+	phaseTimes.clear();
+
+	return firstError;
+}
+
+auto TemplateIoTransaction::countRead(std::error_code error) noexcept -> void
+{
+	count(IoCounter::Reads);
+	if (error)
+	{
+		count(IoCounter::FailedReads);
+	}
 }
 
-auto TemplateIoTransaction::updateOutputs(std::chrono::system_clock::time_point timeStamp, std::error_code error, const OutputList &outputs) -> void
+auto TemplateIoTransaction::updateOutputs(std::chrono::system_clock::time_point timeStamp,
+	const WriteCommand &command,
+	const OutputList &outputs,
+	OverrunMonitor *overruns) -> void
 {
+	TEMPLATE_DRIVER_TRACE_SCOPE(update_outputs, this, outputs.size(), command.dataSize());
+
+	// The "write" and "exchange" tasks and immediate writes may all update the write state at the same time
+	std::scoped_lock lock { _writeMutex };
+
 	// Protect use of the pending event buffer
-	RuntimeBufferSentinel eventsToRaiseSentinel(_runtimeBuffers._eventsToRaise);
+	RuntimeBufferSentinel eventsToRaiseSentinel(_runtimeBuffers._writeEventsToRaise);
 
 	// Make a write sentinel
-	memory::WriteSentinel sentinel { _readDataBlock };
+	memory::WriteSentinel sentinel { _writeDataBlock };
 
-	// Update the latest state
-	_writeState.update(sentinel, timeStamp, error, _runtimeBuffers._eventsToRaise);
+	// Update the latest state using the first error that occurred
+	const auto blocks = command.blocks();
+	const auto failedBlock = std::ranges::find_if(blocks, [](const WriteCommand::Block &block) { return bool(block._error); });
+	_writeState.update(sentinel, timeStamp, failedBlock != blocks.end() ? failedBlock->_error : std::error_code(), _runtimeBuffers._writeEventsToRaise);
+	count(IoCounter::Writes);
+	if (failedBlock != blocks.end())
+	{
+		count(IoCounter::FailedWrites);
+	}
 
-	// Update all the relevant outputs
-	for (auto &&output : outputs)
+	// Update all the relevant outputs using the result of the request that wrote them
+	for (auto &&block : blocks)
 	{
-		output.get().updateWriteState(sentinel, timeStamp, error, _runtimeBuffers._eventsToRaise);
+		for (auto &&entry : command.entries(block))
+		{
+			outputs[entry._index].get().updateWriteState(sentinel, timeStamp, block._error, _runtimeBuffers._writeEventsToRaise);
+		}
+	}
+
+	// Check for an overrun of the task, so that the overrun event is raised together with the data
+	if (overruns)
+	{
+		overruns->check(_runtimeBuffers._writeEventsToRaise);
 	}
 
 	// Commit the data and raise the events
-	sentinel.commit(timeStamp, _runtimeBuffers._eventsToRaise);
+	sentinel.commit(timeStamp, _runtimeBuffers._writeEventsToRaise);
 }
 
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -4,10 +4,25 @@
 #include "Attributes.hpp"
 #include "CommonReadState.hpp"
 #include "WriteState.hpp"
+#include "AbstractImmediateWriter.hpp"
+#include "AbstractIoRequest.hpp"
 #include "CustomError.hpp"
+#include "Events.hpp"
+#include "ExchangeTask.hpp"
+#include "IoCompletionRing.hpp"
+#include "IoCoroutine.hpp"
+#include "IoCounters.hpp"
+#include "IoPriority.hpp"
+#include "OverrunMonitor.hpp"
+#include "PendingOutputSet.hpp"
 #include "Types.hpp"
 #include "ReadCommand.hpp"
+#include "ReadCostModel.hpp"
+#include "ReadOperation.hpp"
+#include "ReadPhaseTimes.hpp"
 #include "ReadTask.hpp"
+#include "TimingStatistics.hpp"
+#include "WriteCommand.hpp"
 #include "WriteTask.hpp"
 
 #include <xentara/memory/Array.hpp>
@@ -18,9 +33,15 @@
 #include <xentara/utils/core/Uuid.hpp>
 #include <xentara/utils/eh/expected.hpp>
 
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
 #include <string_view>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
 #include <vector>
 
 namespace xentara::plugins::templateDriver
@@ -29,12 +50,16 @@ namespace xentara::plugins::templateDriver
 using namespace std::literals;
 
 class TemplateIoComponent;
+class TemplateIoSession;
+class TemplatePollingGroup;
 class AbstractInput;
 class AbstractOutput;
 
 /// @brief A class representing a specific type of I/O transaction.
 /// @todo rename this class to something more descriptive
-class TemplateIoTransaction final : public skill::Element, public skill::EnableSharedFromThis<TemplateIoTransaction>
+class TemplateIoTransaction final :
+	public skill::Element,
+	public skill::EnableSharedFromThis<TemplateIoTransaction>
 {
 public:
 	/// @brief The class object containing meta-information about this element type
@@ -65,9 +90,12 @@ public:
 	auto forEachReadStateEvent(const model::ForEachEventFunction &function) -> bool;
 
 	/// @brief Creates a read-handle for an attribute that belong to the common read state.
+	/// @param operation The read operation whose read state to use, or nullptr to use the combined read state of the
+	/// entire transaction.
 	/// @param attribute The attribute to create the handle for
 	/// @return A read handle for the attribute, or std::nullopt if the read state doesn't know the attribute
-	auto makeReadStateReadHandle(const model::Attribute &attribute) const noexcept -> std::optional<data::ReadHandle>;
+	auto makeReadStateReadHandle(const ReadOperation *operation, const model::Attribute &attribute) const noexcept
+		-> std::optional<data::ReadHandle>;
 
 	/// @brief Gets the data block that holds the data for the read operations
 	constexpr auto readDataBlock() noexcept -> DataBlock &
@@ -105,6 +133,8 @@ public:
 
 	auto makeReadHandle(const model::Attribute &attribute) const noexcept -> std::optional<data::ReadHandle> final;
 
+	auto makeWriteHandle(const model::Attribute &attribute) noexcept -> std::optional<data::WriteHandle> final;
+
 	auto category() const noexcept -> model::ElementCategory final
 	{
 		return model::ElementCategory::Transaction;
@@ -116,37 +146,323 @@ private:
 	// The tasks need access to out private member functions
 	friend class ReadTask<TemplateIoTransaction>;
 	friend class WriteTask<TemplateIoTransaction>;
+	friend class ExchangeTask<TemplateIoTransaction>;
+	// The polling groups drive the reads of their transactions
+	friend class TemplatePollingGroup;
 
 	/// @brief This function is called by the "read" task.
 	///
-	/// This function attempts to read the value if the I/O component is up.
+	/// This function attempts to read the value if the I/O component is up. It does nothing if the transaction belongs to
+	/// a polling group, because the polling group reads the inputs instead.
 	auto performReadTask(const process::ExecutionContext &context) -> void;
 	/// @brief Attempts to read the data from the I/O component and updates the state accordingly.
 	auto read(std::chrono::system_clock::time_point timeStamp) -> void;
+	/// @brief Collects the responses to the read commands issued in the last cycle, updates the state accordingly, and
+	/// issues the next read commands without waiting for their responses.
+	///
+	/// This is used instead of read() if pipelined reads are configured. The inputs lag one cycle behind, but the task
+	/// does not have to wait for the I/O component to respond.
+	auto readPipelined(std::chrono::system_clock::time_point timeStamp) -> void;
+
+	/// @brief Adds the transaction to a polling group
+	///
+	/// This is called when the polling group is prepared. From then on, the "read" and "exchange" tasks of the transaction
+	/// do nothing, so that they cannot interfere with the reads of the polling group.
+	/// @throw std::runtime_error The transaction already belongs to another polling group
+	auto joinPollingGroup(const TemplatePollingGroup &group) -> void;
+	/// @brief Removes the transaction from its polling group again
+	auto leavePollingGroup() noexcept -> void
+	{
+		_pollingGroup = nullptr;
+	}
+
+	/// @brief Sends the read commands on behalf of a polling group, without waiting for the responses
+	///
+	/// If some of the read commands of the last cycle have still not completed, no new commands are sent, because the
+	/// responses are received into the buffers of the commands.
+	auto startGroupRead() noexcept -> void;
+	/// @brief Waits for the responses to the read commands sent by startGroupRead(), and updates the inputs
+	/// @param timeStamp The update time stamp, which is shared by all the transactions of the polling group
+	/// @param deadline If not all the responses have arrived by this time, the inputs are updated with a timeout error instead.
+	/// The outstanding commands are collected by the next call to startGroupRead(). If this is std::nullopt, the function
+	/// waits for all the responses.
+	auto finishGroupRead(std::chrono::system_clock::time_point timeStamp, std::optional<std::chrono::steady_clock::time_point> deadline) -> void;
 
 	/// @brief This function is called by the "write" task.
 	///
 	/// This function attempts to write the value if the I/O component is up.
 	auto performWriteTask(const process::ExecutionContext &context) -> void;
 	/// @brief Attempts to write any pending value to the I/O component and updates the state accordingly.
-	auto write(std::chrono::system_clock::time_point timeStamp) -> void;	
+	/// @param timeStamp The update time stamp
+	/// @param priority The priority class to send the write requests with
+	/// @param overruns The overrun monitor of the task performing the write, or nullptr if the write is not part of a
+	/// monitored task cycle.
+	auto write(std::chrono::system_clock::time_point timeStamp, IoPriority priority, OverrunMonitor *overruns) -> void;
 
-	/// @brief Invalidates any read data
+	/// @brief This function is called by the "exchange" task.
+	///
+	/// This function attempts to write any pending values and read the inputs using combined commands. It does nothing if
+	/// the transaction belongs to a polling group, because the polling group reads the inputs instead.
+	auto performExchangeTask(const process::ExecutionContext &context) -> void;
+	/// @brief Writes any pending values and reads the inputs, combining each write request with a read command.
+	///
+	/// This halves the number of round trips compared to separate read and write tasks, if the I/O component supports
+	/// commands that write and then read data.
+	auto exchange(std::chrono::system_clock::time_point timeStamp) -> void;
+
+	/// @brief Sends a write request, a read command, or a combined command to the I/O component
+	/// @param session The session to send the request over
+	/// @param command The write command the write request belongs to, or nullptr to only read
+	/// @param block The write request to send, or nullptr to only read
+	/// @param operation The read operation to execute, or nullptr to only write
+	/// @param requestId The ID the response will carry
+	/// @throw std::system_error The request could not be sent
+	auto sendRequest(TemplateIoSession &session,
+		const WriteCommand *command,
+		const WriteCommand::Block *block,
+		ReadOperation *operation,
+		std::uint32_t requestId) -> void;
+	/// @brief Receives the rest of the response to a request sent using sendRequest(), and records the result
+	///
+	/// This is called after the header of the response has been received using TemplateIoSession::receiveResponseId().
+	/// @param session The session the request was sent over
+	/// @param block The write request that was sent, or nullptr
+	/// @param operation The read operation that was executed, or nullptr
+	/// @throw std::system_error The response could not be received, or reported an error
+	auto receiveResponse(TemplateIoSession &session, WriteCommand::Block *block, ReadOperation *operation) -> void;
+
+	/// @brief A request that executes a write request, a read command, or both, on the I/O worker of the I/O component
+	///
+	/// The request is awaited by an I/O coroutine, which is resumed once the request has completed. The request also holds the
+	/// memory for the frame of the coroutine.
+	class IoRequest final : public AbstractIoRequest, public IoCoroutineFrame
+	{
+	public:
+		/// @brief This constructor attaches the request to its transaction
+		/// @param transaction The transaction
+		/// @param command The write command the write requests executed by this request belong to, or nullptr if the
+		/// request only reads
+		IoRequest(TemplateIoTransaction &transaction, const WriteCommand *command) : _transaction(transaction), _command(command)
+		{
+		}
+
+		/// @brief Sets what the request should execute
+		/// @param block The write request to send, or nullptr to only read
+		/// @param operation The read operation to execute, or nullptr to only write
+		/// @param priority The priority class to submit the request with. Requests that write use at least the Normal class.
+		auto assign(WriteCommand::Block *block, ReadOperation *operation, IoPriority priority) noexcept -> void
+		{
+			_block = block;
+			_operation = operation;
+			_priority = priority;
+		}
+
+		/// @brief Gets the write request to send, or nullptr
+		auto block() const noexcept -> WriteCommand::Block *
+		{
+			return _block;
+		}
+
+		/// @brief Gets the read operation to execute, or nullptr
+		auto operation() const noexcept -> ReadOperation *
+		{
+			return _operation;
+		}
+
+		/// @name Awaitable Interface
+		/// Awaiting the request executes it once, and returns the error, or a default constructed std::error_code object
+		/// if the request succeeded.
+		/// @{
+
+		auto await_ready() const noexcept -> bool
+		{
+			return false;
+		}
+
+		auto await_suspend(std::coroutine_handle<> continuation) noexcept -> bool;
+
+		auto await_resume() const noexcept -> std::error_code
+		{
+			return _error;
+		}
+
+		/// @}
+
+		/// @name Virtual Overrides for AbstractIoRequest
+		/// @{
+
+		auto connection() noexcept -> AbstractIoConnection & final;
+
+		auto send(std::uint32_t requestId) noexcept -> bool final;
+
+		auto receive() noexcept -> void final;
+
+		auto fail(std::error_code error) noexcept -> void final;
+
+		/// @}
+
+	private:
+		/// @brief Records the result of an attempt, and resumes the coroutine awaiting the request
+		auto complete(std::error_code error) noexcept -> void;
+
+		/// @brief The transaction
+		TemplateIoTransaction &_transaction;
+		/// @brief The write command the write requests belong to, or nullptr
+		const WriteCommand *_command { nullptr };
+
+		/// @brief The write request to send, or nullptr
+		WriteCommand::Block *_block { nullptr };
+		/// @brief The read operation to execute, or nullptr
+		ReadOperation *_operation { nullptr };
+		/// @brief The priority class to submit the request with
+		IoPriority _priority { IoPriority::Normal };
+
+		/// @brief The session the current attempt is sent over
+		TemplateIoSession *_session { nullptr };
+		/// @brief The coroutine awaiting the request
+		std::coroutine_handle<> _continuation;
+		/// @brief The error of the last attempt
+		std::error_code _error;
+	};
+
+	/// @brief The requests used by one of the tasks, together with the ring their completions are reported in
+	struct IoRequestSet final
+	{
+		/// @brief Allocates the requests and the completion ring
+		/// @param transaction The transaction the requests belong to
+		/// @param count The maximum number of requests the task submits in one cycle
+		/// @param command The write command the write requests of the task belong to, or nullptr if the task only reads
+		auto reset(TemplateIoTransaction &transaction, std::size_t count, const WriteCommand *command = nullptr) -> void;
+
+		/// @brief The preallocated requests
+		std::vector<std::unique_ptr<IoRequest>> _requests;
+		/// @brief The ring the completions are reported in
+		IoCompletionRing _completions;
+		/// @brief The number of requests submitted, but not waited for yet
+		std::size_t _submitted { 0 };
+	};
+
+	/// @brief Writes a single output as soon as a value is scheduled for it, without waiting for the "write" task
+	///
+	/// The write is handed to the I/O worker with the Control priority, and the thread that scheduled the value does not
+	/// wait for it. Each output that must be written immediately has its own object, so that only that output is written.
+	/// All values of the output are written by this object, and never by the "write" or "exchange" tasks, so that the
+	/// writes cannot overtake each other.
+	///
+	/// The write state is updated, and the write events are raised, by the thread that completes the request. If the
+	/// I/O component has an I/O worker, this is the I/O worker thread rather than a thread of the Xentara scheduler.
+	struct ImmediateWrite final : public AbstractImmediateWriter
+	{
+		/// @brief This constructor attaches the object to its transaction and output
+		ImmediateWrite(TemplateIoTransaction &transaction, AbstractOutput &output) : _transaction(transaction), _output(output)
+		{
+		}
+
+		/// @name Virtual Overrides for AbstractImmediateWriter
+		/// @{
+
+		auto writeImmediately() noexcept -> void final;
+
+		/// @}
+
+		/// @brief The transaction
+		TemplateIoTransaction &_transaction;
+		/// @brief The output to write
+		std::reference_wrapper<AbstractOutput> _output;
+		/// @brief A marker for the output in the pending output set, used to hand the write to the next write cycle if it cannot
+		/// be started. The write cycle then starts it again.
+		PendingOutputSet::Marker _retryMarker;
+		/// @brief The write command, which holds the single value to write
+		WriteCommand _command;
+		/// @brief The output to notify after the write
+		OutputList _outputsToNotify;
+		/// @brief The request used to send the write, together with its completion ring
+		IoRequestSet _requests;
+		/// @brief The number of times the output was marked since the last write started.
+		///
+		/// Only the thread that increments this from zero starts a write. The write repeats until the count drops back to zero,
+		/// so that values scheduled while the write is in progress are not left behind.
+		std::atomic<std::size_t> _markCount { 0 };
+	};
+
+	/// @brief Executes a write request, a read command, or a combined command directly, without the I/O worker
+	/// @param session The session to send the request over
+	/// @param command The write command the write request belongs to, or nullptr to only read
+	/// @param block The write request to send, or nullptr to only read
+	/// @param operation The read operation to execute, or nullptr to only write
+	/// @return The error, or a default constructed std::error_code object if the request succeeded
+	auto executeRequest(TemplateIoSession &session, const WriteCommand *command, WriteCommand::Block *block, ReadOperation *operation) noexcept
+		-> std::error_code;
+	/// @brief Starts writing an output immediately. This is called by the thread that scheduled the value.
+	auto startImmediateWrite(ImmediateWrite &write) noexcept -> void;
+	/// @brief Writes an output immediately, and updates the write state, until no new values have been scheduled for the output
+	///
+	/// This is a coroutine that is suspended while the write is executed by the I/O worker, so that no thread is blocked.
+	/// @param write The output to write
+	/// @param request The request to use for the write
+	auto performImmediateWrite(ImmediateWrite &write, IoRequest &request) -> IoCoroutine;
+	/// @brief Executes a request, retrying it if it fails, and records the result
+	///
+	/// This is a coroutine that is suspended while the request is executed by the I/O worker, so that no thread is blocked.
+	/// @param request The request, which must already have been assigned
+	auto performRequest(IoRequest &request) -> IoCoroutine;
+	/// @brief Records an error for a write request, a read command, or both
+	auto recordRequestError(WriteCommand::Block *block, ReadOperation *operation, std::error_code error) noexcept -> void;
+	/// @brief Starts a request on the I/O worker of the I/O component, or executes it directly if there is no I/O worker
+	/// @param requests The request set of the calling task
+	/// @param block The write request to send, or nullptr to only read
+	/// @param operation The read operation to execute, or nullptr to only write
+	/// @param priority The priority class to submit the request with. Requests that write use at least the Normal class.
+	auto submitRequest(IoRequestSet &requests, WriteCommand::Block *block, ReadOperation *operation, IoPriority priority) noexcept -> void;
+	/// @brief Waits for all the requests submitted using a request set to complete
+	auto awaitRequests(IoRequestSet &requests) noexcept -> void;
+	/// @brief Waits for all the requests submitted using a request set to complete, up to a deadline
+	/// @return Returns true if all the requests have completed, or false if the deadline expired first
+	auto awaitRequests(IoRequestSet &requests, std::chrono::steady_clock::time_point deadline) noexcept -> bool;
+
+	/// @brief Adds to a counter of the transaction, and to the same counter of the I/O component
+	auto count(IoCounter counter, std::uint64_t amount = 1) noexcept -> void;
+
+	/// @brief Adds all pending output values to a write command, and merges them into write requests
+	/// @param command The write command to add the values to
+	/// @param outputs The outputs that had values will be added to this list, in the order they were added to the command.
+	/// @return Returns true if there were pending outputs, or false if there is nothing to write
+	/// @note The caller must protect the write command and the list of outputs to notify using RuntimeBufferSentinel objects
+	auto collectPendingOutputs(WriteCommand &command, OutputList &outputs) -> bool;
+
+	/// @brief Invalidates any read data when the "read" or "exchange" task stops
+	///
+	/// This does nothing if the transaction belongs to a polling group, because the polling group invalidates the data instead.
 	auto invalidateData(std::chrono::system_clock::time_point timeStamp) -> void;
+	/// @brief Invalidates any read data, regardless of which task reads the inputs
+	auto invalidateInputs(std::chrono::system_clock::time_point timeStamp) -> void;
 
-	/// @brief Updates the inputs with valid data and sends events
+	/// @brief Updates the inputs using the payloads or errors recorded in the read operations, and sends events
 	/// @param timeStamp The update time stamp
-	/// @param payloadOrError This is a variant-like type that will hold either the payload of the read command, or an std::error_code object
-	/// containing a read error.
-	auto updateInputs(std::chrono::system_clock::time_point timeStamp,
-		const utils::eh::expected<std::reference_wrapper<const ReadCommand::Payload>, std::error_code> &payloadOrError) -> void;
-
-	/// @brief Updates the outputs and sends events
+	/// @param overruns The overrun monitor of the task performing the update, or nullptr if the update is not part of a
+	/// monitored task cycle.
+	/// @param error An error to use for all the read operations instead of the recorded results, or a default constructed
+	/// std::error_code object to use the recorded results.
+	/// @return The error of the combined read state, or a default constructed std::error_code object if all reads succeeded
+	auto updateInputs(std::chrono::system_clock::time_point timeStamp, OverrunMonitor *overruns, std::error_code error = {})
+		-> std::error_code;
+
+	/// @brief Counts a read that actually executed the read commands
+	/// @param error The error returned by updateInputs()
+	auto countRead(std::error_code error) noexcept -> void;
+
+	/// @brief Updates the outputs using the errors recorded in the blocks of a write command, and sends events
+	///
+	/// This locks _writeMutex while the write state is being updated.
 	/// @param timeStamp The update time stamp
-	/// @param error The error code, or a default constructed std::error_code object if no error occurred
-	/// @param outputs The outputs to update
-	auto updateOutputs(
-		std::chrono::system_clock::time_point timeStamp, std::error_code error, const OutputList &outputs) -> void;
+	/// @param command The write command that was sent
+	/// @param outputs The outputs to update, in the order they were added to the command
+	/// @param overruns The overrun monitor of the task performing the update, or nullptr if the update is not part of a
+	/// monitored task cycle.
+	auto updateOutputs(std::chrono::system_clock::time_point timeStamp,
+		const WriteCommand &command,
+		const OutputList &outputs,
+		OverrunMonitor *overruns) -> void;
 
 	/// @name Virtual Overrides for skill::Element
 	/// @{
@@ -157,6 +473,8 @@ private:
 
 	auto prepare() -> void final;
 
+	auto cleanup() -> void final;
+
 	/// @}
 
 	/// @brief The I/O component this transaction belongs to
@@ -164,24 +482,102 @@ private:
 	std::reference_wrapper<TemplateIoComponent> _ioComponent;
 
 	/// @class xentara::plugins::templateDriver::TemplateIoTransaction
-	/// @todo Split read and write command split into several commands each, if necessary.
+	/// @todo Split the write requests further, if necessary.
 	/// 
-	/// @todo Some Some I/O components may need to have the read and write command split into several commands each.
-	/// Some I/O components may require a separate command for each data type, for example, or may only be able to
-	/// read or write objects with continuous addresses. if this is the case, each separate command needs its own list
-	/// of inputs and/or output, as well as its own read state and write state.
+	/// @todo The write command already merges outputs with adjacent addresses into write requests according to the write
+	/// limits of the I/O component. Some I/O components may require additional splitting, e.g. a separate request for each
+	/// data type. The read command is already split into several read operations according to the read limits of the I/O component.
 
 	/// @brief The list of inputs
 	std::vector<std::reference_wrapper<AbstractInput>> _inputs;
 	/// @brief The list of outputs
 	std::vector<std::reference_wrapper<AbstractOutput>> _outputs;
+	/// @brief The outputs that have pending values, by index into _outputs
+	PendingOutputSet _pendingOutputs;
 
-	/// @brief The read command to send, or nullptr if it hasn't been constructed yet.
-	std::unique_ptr<ReadCommand> _readCommand;
+	/// @brief The read operations, each of which has its own read command, inputs, and read state
+	///
+	/// The operations are planned by realize(), according to the addresses of the inputs and the read limits of the I/O component.
+	std::vector<std::unique_ptr<ReadOperation>> _readOperations;
+	/// @brief The total number of bytes read by the read operations
+	std::size_t _readSize { 0 };
 
-	/// @class xentara::plugins::templateDriver::TemplateIoTransaction
-	/// @note There is no member for the write command, as the write command is constructed on-the-fly,
-	/// depending on which outputs wave to be written.
+	/// @brief A chunk of the inputs of one of the read operations
+	struct DecodeChunk final
+	{
+		/// @brief The read operation
+		std::reference_wrapper<ReadOperation> _operation;
+		/// @brief The index of the chunk within the read operation
+		std::size_t _chunk { 0 };
+	};
+	/// @brief The chunks of the inputs of all the read operations, which are divided between the decode threads.
+	/// This is only used if more than one decode thread is configured.
+	std::vector<DecodeChunk> _decodeChunks;
+
+	/// @brief The priority class of the requests of this transaction. Write requests always use at least the Normal class.
+	IoPriority _priority { IoPriority::Normal };
+
+	/// @brief The number of times a failed request is repeated before the error is reported
+	std::size_t _requestRetries { 0 };
+	/// @brief The time each attempt of a request may take before it fails with CustomError::Timeout
+	/// @todo adjust the default to the response times of the I/O component
+	std::chrono::milliseconds _requestTimeout { 1000 };
+
+	/// @brief The number of threads used to update the inputs, including the thread executing the task
+	std::size_t _decodeThreads { 1 };
+
+	/// @brief Whether the read task issues the read commands for the next cycle instead of waiting for the responses
+	bool _pipelinedRead { false };
+	/// @brief Whether read commands have been issued by readPipelined() since the data was last invalidated
+	bool _pipelinedReadsIssued { false };
+	/// @brief Whether startGroupRead() sent new read commands in the current cycle
+	bool _groupReadIssued { false };
+	/// @brief The polling group that reads the inputs, or nullptr if the transaction's own tasks read them.
+	///
+	/// This is only changed while the elements are being prepared or cleaned up, when no tasks are running.
+	const TemplatePollingGroup *_pollingGroup { nullptr };
+
+	/// @brief The cost model used to split the inputs into read operations
+	ReadCostModel _readCostModel;
+
+	/// @brief Statistics about the read operations, for tuning the cost model
+	struct
+	{
+		/// @brief The number of read commands sent by each read
+		std::atomic<std::uint64_t> _commandCount { 0 };
+		/// @brief The number of bytes read by each read that do not belong to any input
+		std::atomic<std::uint64_t> _unusedBytes { 0 };
+	} _readPlanStatistics;
+
+	/// @brief Statistics about the durations and start times of the tasks, for sizing the cycle times
+	TimingStatistics _timingStatistics;
+
+	/// @brief Counters for the operations of the transaction. The same counts are also added to the counters of the I/O component.
+	IoCounters _counters;
+
+	/// @brief Detects overruns of the "read" task
+	OverrunMonitor _readOverruns { attributes::kReadOverrunCount, attributes::kConsecutiveReadOverruns, events::kReadOverrun, io::Direction::Input };
+	/// @brief Detects overruns of the "write" task
+	OverrunMonitor _writeOverruns { attributes::kWriteOverrunCount, attributes::kConsecutiveWriteOverruns, events::kWriteOverrun, io::Direction::Output };
+	/// @brief Detects overruns of the "exchange" task. The overrun event is raised together with the inputs.
+	OverrunMonitor _exchangeOverruns {
+		attributes::kExchangeOverrunCount, attributes::kConsecutiveExchangeOverruns, events::kExchangeOverrun, io::Direction::Input };
+
+	/// @brief A mutex that serializes the updates of the write state by the "write" and "exchange" tasks and by immediate writes
+	///
+	/// This is only held while the write state is being updated, and never while requests are being executed, so that an
+	/// immediate write completing does not have to wait for a read.
+	std::mutex _writeMutex;
+
+	/// @brief The write command of the "write" task
+	///
+	/// The buffers of the command are allocated by realize(), and the command is filled with the pending outputs by write().
+	WriteCommand _writeCommand;
+	/// @brief The write command of the "exchange" task
+	WriteCommand _exchangeWriteCommand;
+
+	/// @brief The immediate writes of the outputs that must be written immediately
+	std::vector<std::unique_ptr<ImmediateWrite>> _immediateWrites;
 
 	/// @brief The array that describes the structure of the read data block
 	memory::Array _readDataArray;
@@ -193,7 +589,10 @@ private:
 	/// @brief The data block that holds the data for the outputs
 	DataBlock _writeDataBlock { _writeDataArray };
 
-	/// @brief The common read state for all inputs
+	/// @brief The combined read state of all the read operations
+	///
+	/// This state is good only if all the read operations succeeded. The inputs inherit the read state of their own
+	/// read operation instead, except for the read event, which they inherit from this state.
 	CommonReadState _readState;
 	/// @brief The state for the last write command 
 	WriteState _writeState;
@@ -202,6 +601,15 @@ private:
 	ReadTask<TemplateIoTransaction> _readTask { *this };
 	/// @brief The "write" task
 	WriteTask<TemplateIoTransaction> _writeTask { *this };
+	/// @brief The "exchange" task
+	ExchangeTask<TemplateIoTransaction> _exchangeTask { *this };
+
+	/// @brief The I/O worker requests of the "read" task
+	IoRequestSet _readRequests;
+	/// @brief The I/O worker requests of the "write" task
+	IoRequestSet _writeRequests;
+	/// @brief The I/O worker requests of the "exchange" task
+	IoRequestSet _exchangeRequests;
 
 	/// @brief Preallocated runtime buffers
 	///
@@ -210,11 +618,23 @@ private:
 	/// which would not be real-time safe.
 	struct
 	{
-		/// @brief The list of events to raise after a read or write
+		/// @brief The list of events to raise after a read
 		PendingEventList _eventsToRaise;
-
-		/// @brief The outputs to notify after a write operation
+		/// @brief The lists of events collected by the decode pool threads, one for each thread after the first.
+		/// The events are moved to _eventsToRaise before they are raised.
+		std::unique_ptr<PendingEventList[]> _decodeEventsToRaise;
+		/// @brief The time spent in the phases of the current read, one entry for each thread used to update the inputs.
+		/// The first entry is used by the thread executing the task, the others by the decode pool threads.
+		std::unique_ptr<ReadPhaseTimes[]> _readPhaseTimes;
+
+		/// @brief The list of events to raise after a write. This is separate from the read list, because immediate
+		/// writes may happen while the inputs are being updated.
+		PendingEventList _writeEventsToRaise;
+
+		/// @brief The outputs to notify after a write operation of the "write" task
 		OutputList _outputsToNotify;
+		/// @brief The outputs to notify after a write operation of the "exchange" task
+		OutputList _exchangeOutputsToNotify;
 	} _runtimeBuffers;
 
 	/// @class xentara::plugins::templateDriver::TemplateIoTransaction::RuntimeBufferSentinel
@@ -16,6 +16,10 @@
 #include <xentara/utils/json/decoder/Object.hpp>
 #include <xentara/utils/json/decoder/Errors.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
 namespace xentara::plugins::templateDriver
 {
 	
@@ -25,6 +29,8 @@ auto TemplateOutput::load(utils::json::decoder::Object &jsonObject, config::Cont
 {
 	// Go through all the members of the JSON object that represents this object
 	bool ioTransactionLoaded = false;
+	bool addressLoaded = false;
+	std::optional<std::size_t> size;
 	for (auto && [name, value] : jsonObject)
     {
 		if (name == "dataType"sv)
@@ -43,6 +49,24 @@ auto TemplateOutput::load(utils::json::decoder::Object &jsonObject, config::Cont
 				});
 			ioTransactionLoaded = true;
 		}
+		/// @todo use keywords and an address format that are appropriate to the I/O component
+		else if (name == "address"sv)
+		{
+			_dataAddress._address = value.asNumber<std::uint64_t>();
+			addressLoaded = true;
+		}
+		else if (name == "size"sv)
+		{
+			size = value.asNumber<std::size_t>();
+		}
+		else if (name == "byteOrder"sv)
+		{
+			_dataAddress._byteOrder = loadByteOrder(value);
+		}
+		else if (name == "immediateWrite"sv)
+		{
+			_immediateWrite = value.asBool();
+		}
 		/// @todo load custom configuration parameters
 		else if (name == "TODO"sv)
 		{
@@ -76,6 +100,24 @@ auto TemplateOutput::load(utils::json::decoder::Object &jsonObject, config::Cont
 		/// @todo replace "I/O transaction" and "template output" with more descriptive names
 		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("missing I/O transaction in template output"));
 	}
+	// Make sure that an address was specified
+	if (!addressLoaded)
+	{
+		/// @todo replace "template output" with a more descriptive name
+		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("missing address in template output"));
+	}
+	// Determine the size of the value, using the default size for the data type if none was specified
+	_dataAddress._size = size.value_or(_handler->defaultSize());
+	if (_dataAddress._size == 0)
+	{
+		/// @todo replace "template output" with a more descriptive name
+		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("missing size in template output"));
+	}
+	if (!_handler->isValidSize(_dataAddress._size))
+	{
+		/// @todo replace "template output" with a more descriptive name
+		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("size is not valid for data type in template output"));
+	}
 	/// @todo perform consistency and completeness checks
 	if (!"TODO")
 	{
@@ -280,21 +322,30 @@ auto TemplateOutput::attachInput(memory::Array &dataArray, std::size_t &eventCou
 	_handler->attachReadState(dataArray, eventCount);
 }
 
-auto TemplateOutput::updateReadState(WriteSentinel &writeSentinel,
-	std::chrono::system_clock::time_point timeStamp,
-	const utils::eh::expected<std::reference_wrapper<const ReadCommand::Payload>, std::error_code> &payloadOrError,
-	const CommonReadState::Changes &commonChanges,
-	PendingEventList &eventsToRaise) -> void
+auto TemplateOutput::valueTypeIndex() const -> std::size_t
+{
+	// valueTypeIndex() must not be called before the configuration was loaded, so the handler should have been
+	// created already.
+	if (!_handler) [[unlikely]]
+	{
+		throw std::logic_error("internal error: xentara::plugins::templateDriver::TemplateOutput::valueTypeIndex() called before configuration has been loaded");
+	}
+
+	// Forward the request to the handler
+	return _handler->valueTypeIndex();
+}
+
+auto TemplateOutput::addToReadOperation(ReadOperation &operation) -> void
 {
-	// updateReadState() must not be called before the configuration was loaded, so the handler should have been
+	// addToReadOperation() must not be called before the configuration was loaded, so the handler should have been
 	// created already.
 	if (!_handler) [[unlikely]]
 	{
-		throw std::logic_error("internal error: xentara::plugins::templateDriver::TemplateOutput::updateReadState() called before configuration has been loaded");
+		throw std::logic_error("internal error: xentara::plugins::templateDriver::TemplateOutput::addToReadOperation() called before configuration has been loaded");
 	}
 
 	// Forward the request to the handler
-	_handler->updateReadState(writeSentinel, timeStamp, payloadOrError, commonChanges, eventsToRaise);
+	_handler->addToReadOperation(operation, _dataAddress);
 }
 
 auto TemplateOutput::addToWriteCommand(WriteCommand &command) -> bool
@@ -307,10 +358,10 @@ auto TemplateOutput::addToWriteCommand(WriteCommand &command) -> bool
 	}
 
 	// Forward the request to the handler
-	return _handler->addToWriteCommand(command);
+	return _handler->addToWriteCommand(command, _dataAddress);
 }
 
-auto TemplateOutput::attachOutput(memory::Array &dataArray, std::size_t &eventCount) -> void
+auto TemplateOutput::attachOutput(memory::Array &dataArray, std::size_t &eventCount, PendingOutputSet::Marker pendingMarker) -> void
 {
 	// attachOutput() must not be called before the configuration was loaded, so the handler should have been
 	// created already.
@@ -320,7 +371,7 @@ auto TemplateOutput::attachOutput(memory::Array &dataArray, std::size_t &eventCo
 	}
 
 	// Attach the write state of the handler
-	_handler->attachWriteState(dataArray, eventCount);
+	_handler->attachWriteState(dataArray, eventCount, pendingMarker);
 }
 
 auto TemplateOutput::updateWriteState(WriteSentinel &writeSentinel,
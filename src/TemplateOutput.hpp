@@ -4,6 +4,7 @@
 #include "AbstractTemplateOutputHandler.hpp"
 #include "AbstractInput.hpp"
 #include "AbstractOutput.hpp"
+#include "DataAddress.hpp"
 
 #include <xentara/process/Task.hpp>
 #include <xentara/skill/DataPoint.hpp>
@@ -72,20 +73,28 @@ public:
 	
 	auto attachInput(memory::Array &dataArray, std::size_t &eventCount) -> void final;
 
-	auto updateReadState(WriteSentinel &writeSentinel,
-		std::chrono::system_clock::time_point timeStamp,
-		const utils::eh::expected<std::reference_wrapper<const ReadCommand::Payload>, std::error_code> &payloadOrError,
-		const CommonReadState::Changes &commonChanges,
-		PendingEventList &eventsToRaise) -> void final;
+	auto dataAddress() const -> const DataAddress & final
+	{
+		return _dataAddress;
+	}
+
+	auto valueTypeIndex() const -> std::size_t final;
+
+	auto addToReadOperation(ReadOperation &operation) -> void final;
 	
 	/// @}
 
 	/// @name Virtual Overrides for AbstractOutput
 	/// @{
 
+	auto immediateWrite() const -> bool final
+	{
+		return _immediateWrite;
+	}
+
 	auto addToWriteCommand(WriteCommand &command) -> bool final;
 
-	auto attachOutput(memory::Array &dataArray, std::size_t &eventCount) -> void final;
+	auto attachOutput(memory::Array &dataArray, std::size_t &eventCount, PendingOutputSet::Marker pendingMarker) -> void final;
 
 	auto updateWriteState(
 		WriteSentinel &writeSentinel,
@@ -117,8 +126,11 @@ private:
 	/// @brief The handler for data type specific functionality, or nullptr, if the data type hans not been loaded yet
 	std::unique_ptr<AbstractTemplateOutputHandler> _handler;
 
-	/// @class xentara::plugins::templateDriver::TemplateOutput
-	/// @todo add information needed to decode the value from the payload of a read command, like e.g. a data offset.
+	/// @brief The address of the value in the I/O component
+	DataAddress _dataAddress;
+
+	/// @brief Whether written values are sent to the I/O component right away, instead of in the next write cycle
+	bool _immediateWrite { false };
 };
 
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
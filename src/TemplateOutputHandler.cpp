@@ -2,7 +2,10 @@
 #include "TemplateOutputHandler.hpp"
 
 #include "Attributes.hpp"
+#include "ReadBatch.hpp"
+#include "ReadOperation.hpp"
 #include "TemplateIoTransaction.hpp"
+#include "WriteCommand.hpp"
 
 #include <xentara/data/DataType.hpp>
 #include <xentara/data/ReadHandle.hpp>
@@ -49,6 +52,41 @@ auto TemplateOutputHandler<ValueType>::dataType() const -> const data::DataType
 	return kValueAttribute.dataType();
 }
 
+template <typename ValueType>
+auto TemplateOutputHandler<ValueType>::defaultSize() const -> std::size_t
+{
+	/// @todo use the sizes the I/O component uses for the different value types
+	if constexpr (utils::tools::StringType<ValueType>)
+	{
+		// Strings have no default size
+		return 0;
+	}
+	else
+	{
+		return sizeof(ValueType);
+	}
+}
+
+template <typename ValueType>
+auto TemplateOutputHandler<ValueType>::isValidSize(std::size_t size) const -> bool
+{
+	/// @todo check the size against the sizes the I/O component supports for the different value types
+	if constexpr (utils::tools::StringType<ValueType>)
+	{
+		// Strings can have any size
+		return size > 0;
+	}
+	// Integers can also be stored in fewer bytes, and will be sign or zero extended
+	else if constexpr (utils::tools::Integral<ValueType>)
+	{
+		return (size == 1 || size == 2 || size == 4 || size == 8) && size <= sizeof(ValueType);
+	}
+	else
+	{
+		return size == sizeof(ValueType);
+	}
+}
+
 template <typename ValueType>
 auto TemplateOutputHandler<ValueType>::forEachAttribute(const model::ForEachAttributeFunction &function, TemplateIoTransaction &ioTransaction) const -> bool
 {
@@ -96,8 +134,8 @@ auto TemplateOutputHandler<ValueType>::makeReadHandle(const model::Attribute &at
 	{
 		return handle;
 	}
-	// Also handle the common read state attributes from the I/O transaction
-	if (auto handle = ioTransaction.makeReadStateReadHandle(attribute))
+	// Also handle the common read state attributes from the read operation
+	if (auto handle = ioTransaction.makeReadStateReadHandle(_readOperation, attribute))
 	{
 		return handle;
 	}
@@ -135,67 +173,27 @@ auto TemplateOutputHandler<ValueType>::attachReadState(memory::Array &dataArray,
 }
 
 template <typename ValueType>
-auto TemplateOutputHandler<ValueType>::updateReadState(WriteSentinel &writeSentinel,
-	std::chrono::system_clock::time_point timeStamp,
-	const utils::eh::expected<std::reference_wrapper<const ReadCommand::Payload>, std::error_code> &payloadOrError,
-	const CommonReadState::Changes &commonChanges,
-	PendingEventList &eventsToRaise) -> void
+auto TemplateOutputHandler<ValueType>::valueTypeIndex() const -> std::size_t
 {
-	// Check if we have a valid payload
-	if (payloadOrError)
-	{
-		/// @todo decode the value from the payload data
-		ValueType value = {};
-		
-		/// @todo it may be advantageous to split the decoding of the value up according to value type, either by using helper functions,
-		/// or using if constexpr().
-		//
-		// For example, you could create a function decodeValue(), which would call helper functions named decodeBoolean(), decodeInteger(),
-		// decodeFloatingPoint(), and decodeString(). This function could be implemented like this:
-		// 
-		// template <typename ValueType>
-		// auto TemplateOutputHandler<ValueType>decodeValue(const ReadCommand::Payload &payload) -> dectype(auto)
-		// {
-		//     if constexpr (std::same_as<ValueType, bool>)
-		//     {
-		//         return decodeBoolean(payload);
-		//     }
-		//     else if constexpr (utils::Tools::Integral<ValueType>)
-		//     {
-		//         return decodeInteger(payload);
-		//     }
-		//     else if constexpr (std::floating_point<ValueType>)
-		//     {
-		//         return decodeFloatingPoint(payload);
-		//     }
-		//     else if constexpr (utils::tools::StringType<ValueType>)
-		//     {
-		//         return decodeString(payload);
-		//     }
-		// }
-		// 
-		// To determine if a type is an integer type, you should use xentara::utils::Tools::Integral instead of std::integral,
-		// because std::integral is true for *bool*, *char*, *wchar_t*, *char8_t*, *char16_t*, and *char32_t*, which is generally not desirable.
+	return ReadBatchList::valueTypeIndex<ValueType>();
+}
 
-		// Update the read state
-		_readState.update(writeSentinel, timeStamp, value, commonChanges, eventsToRaise);
-	}
-	// We have an error
-	else
-	{
-		// Update the read state with the error
-		_readState.update(writeSentinel, timeStamp, utils::eh::unexpected(payloadOrError.error()), commonChanges, eventsToRaise);
-	}
+template <typename ValueType>
+auto TemplateOutputHandler<ValueType>::addToReadOperation(ReadOperation &operation, const DataAddress &address) -> void
+{
+	operation.batches().batch<ValueType>().add(_readState, address);
+	_readOperation = &operation;
 }
 
 template <typename ValueType>
-auto TemplateOutputHandler<ValueType>::attachWriteState(memory::Array &dataArray, std::size_t &eventCount) -> void
+auto TemplateOutputHandler<ValueType>::attachWriteState(memory::Array &dataArray, std::size_t &eventCount, PendingOutputSet::Marker pendingMarker) -> void
 {
 	_writeState.attach(dataArray, eventCount);
+	_pendingMarker = pendingMarker;
 }
 
 template <typename ValueType>
-auto TemplateOutputHandler<ValueType>::addToWriteCommand(WriteCommand &command) -> bool
+auto TemplateOutputHandler<ValueType>::addToWriteCommand(WriteCommand &command, const DataAddress &address) -> bool
 {
 	// Get the value
 	auto pendingValue = _pendingOutputValue.dequeue();
@@ -205,34 +203,8 @@ auto TemplateOutputHandler<ValueType>::addToWriteCommand(WriteCommand &command)
 		return false;
 	}
 
-	/// @todo add the value to the command
-
-	/// @todo it may be advantageous to split this function up according to value type, either using explicit 
-	/// template specialization, or using if constexpr().
-	//
-	// For example, this function could be split into addBooleanToWriteCommand(), addIntegerToWriteCommand(),
-	// addFloatingPointToWriteCommand(), and addStringToWriteCommand() functions. These functions could then
-	// be called like this:
-	//
-	// if constexpr (std::same_as<ValueType, bool>)
-	// {
-	//     addBooleanToWriteCommand(command, *pendingValue);
-	// }
-	// else if constexpr (utils::Tools::Integral<ValueType>)
-	// {
-	//     addIntegerToWriteCommand(command, *pendingValue);
-	// }
-	// else if constexpr (std::floating_point<ValueType>)
-	// {
-	//     addFloatingPointToWriteCommand(command, *pendingValue);
-	// }
-	// else if constexpr (utils::tools::StringType<ValueType>)
-	// {
-	//     addStringToWriteCommand(command, *pendingValue);
-	// }
-	//
-	// To determine if a type is an integer type, you should use xentara::utils::Tools::Integral instead of std::integral,
-	// because std::integral is true for *bool*, *char*, *wchar_t*, *char8_t*, *char16_t*, and *char32_t*, which is generally not desirable.
+	// Add the value to the command
+	command.add(address, *pendingValue);
 
 	return true;
 }
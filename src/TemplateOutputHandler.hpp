@@ -33,6 +33,10 @@ public:
 
 	auto dataType() const -> const data::DataType & final;
 
+	auto defaultSize() const -> std::size_t final;
+
+	auto isValidSize(std::size_t size) const -> bool final;
+
 	auto forEachAttribute(const model::ForEachAttributeFunction &function, TemplateIoTransaction &ioTransaction) const -> bool final;
 
 	auto forEachEvent(const model::ForEachEventFunction &function, TemplateIoTransaction &ioTransaction, std::shared_ptr<void> parent) -> bool final;
@@ -43,15 +47,13 @@ public:
 	
 	auto attachReadState(memory::Array &dataArray, std::size_t &eventCount) -> void final;
 
-	auto updateReadState(WriteSentinel &writeSentinel,
-		std::chrono::system_clock::time_point timeStamp,
-		const utils::eh::expected<std::reference_wrapper<const ReadCommand::Payload>, std::error_code> &payloadOrError,
-		const CommonReadState::Changes &commonChanges,
-		PendingEventList &eventsToRaise) -> void final;
+	auto valueTypeIndex() const -> std::size_t final;
+
+	auto addToReadOperation(ReadOperation &operation, const DataAddress &address) -> void final;
 	
-	auto addToWriteCommand(WriteCommand &command) -> bool final;
+	auto addToWriteCommand(WriteCommand &command, const DataAddress &address) -> bool final;
 
-	auto attachWriteState(memory::Array &dataArray, std::size_t &eventCount) -> void final;
+	auto attachWriteState(memory::Array &dataArray, std::size_t &eventCount, PendingOutputSet::Marker pendingMarker) -> void final;
 
 	auto updateWriteState(
 		WriteSentinel &writeSentinel,
@@ -78,15 +80,21 @@ private:
 	auto scheduleOutputValue(ValueType value) noexcept
 	{
 		_pendingOutputValue.enqueue(value);
+		// Mark the output only after enqueuing the value, so the I/O transaction is sure to find it
+		_pendingMarker.mark();
 	}
 
 	/// @brief The read state
 	PerValueReadState<ValueType> _readState;
+	/// @brief The read operation that reads back the value, or nullptr if the I/O transaction has not been realized yet
+	const ReadOperation *_readOperation { nullptr };
 	/// @brief The write state
 	WriteState _writeState;
 
 	/// @brief The queue for the pending output value
 	SingleValueQueue<ValueType> _pendingOutputValue;
+	/// @brief The marker used to tell the I/O transaction that a value is pending
+	PendingOutputSet::Marker _pendingMarker;
 };
 
 /// @class xentara::plugins::templateDriver::TemplateOutputHandler
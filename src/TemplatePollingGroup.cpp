@@ -0,0 +1,116 @@
+// Copyright (c) embedded ocean GmbH
+#include "TemplatePollingGroup.hpp"
+
+#include "Tasks.hpp"
+#include "TemplateIoTransaction.hpp"
+
+#include <xentara/config/Context.hpp>
+#include <xentara/config/Errors.hpp>
+#include <xentara/model/ForEachTaskFunction.hpp>
+#include <xentara/process/ExecutionContext.hpp>
+#include <xentara/utils/json/decoder/Object.hpp>
+#include <xentara/utils/json/decoder/Errors.hpp>
+
+#include <stdexcept>
+
+namespace xentara::plugins::templateDriver
+{
+
+using namespace std::literals;
+
+auto TemplatePollingGroup::load(utils::json::decoder::Object &jsonObject, config::Context &context) -> void
+{
+	// Go through all the members of the JSON object that represents this object
+	bool ioTransactionsLoaded = false;
+	for (auto && [name, value] : jsonObject)
+    {
+		/// @todo use a more descriptive keyword, e.g. "polls"
+		if (name == "ioTransactions"sv)
+		{
+			for (auto &&element : value.asArray())
+			{
+				context.resolve<TemplateIoTransaction>(element, [this](std::reference_wrapper<TemplateIoTransaction> ioTransaction)
+					{
+						_ioTransactions.push_back(ioTransaction);
+					});
+				ioTransactionsLoaded = true;
+			}
+		}
+		else if (name == "deadline"sv)
+		{
+			_deadline = std::chrono::milliseconds(value.asNumber<std::chrono::milliseconds::rep>());
+			if (*_deadline <= std::chrono::milliseconds::zero())
+			{
+				/// @todo replace "template polling group" with a more descriptive name
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("deadline of template polling group must be positive"));
+			}
+		}
+		else
+		{
+            config::throwUnknownParameterError(name);
+		}
+    }
+
+	// Make sure that the group is not empty
+	if (!ioTransactionsLoaded)
+	{
+		/// @todo replace "template polling group" and "I/O transactions" with more descriptive names
+		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("missing I/O transactions in template polling group"));
+	}
+}
+
+auto TemplatePollingGroup::prepare() -> void
+{
+	// Take over the reads of all the transactions, so that their own tasks do not read them as well
+	for (auto &&ioTransaction : _ioTransactions)
+	{
+		ioTransaction.get().joinPollingGroup(*this);
+	}
+}
+
+auto TemplatePollingGroup::cleanup() -> void
+{
+	for (auto &&ioTransaction : _ioTransactions)
+	{
+		ioTransaction.get().leavePollingGroup();
+	}
+}
+
+auto TemplatePollingGroup::forEachTask(const model::ForEachTaskFunction &function) -> bool
+{
+	// Handle all the tasks we support
+	return function(tasks::kRead, sharedFromThis(&_readTask));
+}
+
+auto TemplatePollingGroup::performReadTask(const process::ExecutionContext &context) -> void
+{
+	// Determine the deadline before sending anything, so that it covers the entire group
+	std::optional<std::chrono::steady_clock::time_point> deadline;
+	if (_deadline)
+	{
+		deadline = std::chrono::steady_clock::now() + *_deadline;
+	}
+
+	// Send the read commands of all the transactions first, so that the I/O components process them concurrently
+	for (auto &&ioTransaction : _ioTransactions)
+	{
+		ioTransaction.get().startGroupRead();
+	}
+
+	// Collect the responses, and update the inputs of all the transactions using the same time stamp
+	const auto timeStamp = context.scheduledTime();
+	for (auto &&ioTransaction : _ioTransactions)
+	{
+		ioTransaction.get().finishGroupRead(timeStamp, deadline);
+	}
+}
+
+auto TemplatePollingGroup::invalidateData(std::chrono::system_clock::time_point timeStamp) -> void
+{
+	for (auto &&ioTransaction : _ioTransactions)
+	{
+		ioTransaction.get().invalidateInputs(timeStamp);
+	}
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
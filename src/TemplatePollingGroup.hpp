@@ -0,0 +1,86 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "ReadTask.hpp"
+
+#include <xentara/model/ElementCategory.hpp>
+#include <xentara/skill/Element.hpp>
+#include <xentara/skill/EnableSharedFromThis.hpp>
+#include <xentara/utils/core/Uuid.hpp>
+
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace xentara::plugins::templateDriver
+{
+
+using namespace std::literals;
+
+class TemplateIoTransaction;
+
+/// @brief A group of I/O transactions, possibly of different I/O components, that are read together
+///
+/// The polling group sends the read commands of all its transactions at once, so that the I/O components process them
+/// concurrently, and then updates the inputs of all the transactions using the same time stamp. This gives a consistent
+/// snapshot across all the I/O components, using a single task.
+/// @todo rename this class to something more descriptive
+class TemplatePollingGroup final : public skill::Element, public skill::EnableSharedFromThis<TemplatePollingGroup>
+{
+public:
+	/// @brief The class object containing meta-information about this element type
+	/// @todo change class name
+	/// @todo assign a unique UUID
+	/// @todo change display name
+	using Class = ConcreteClass<"TemplatePollingGroup",
+		"deadbeef-dead-beef-dead-beefdeadbeef"_uuid,
+		"template driver polling group">;
+
+	/// @name Virtual Overrides for skill::Element
+	/// @{
+
+	auto forEachTask(const model::ForEachTaskFunction &function) -> bool final;
+
+	auto category() const noexcept -> model::ElementCategory final
+	{
+		return model::ElementCategory::Transaction;
+	}
+
+	/// @}
+
+private:
+	// The tasks need access to out private member functions
+	friend class ReadTask<TemplatePollingGroup>;
+
+	/// @brief This function is called by the "read" task.
+	///
+	/// This function reads the inputs of all the I/O transactions.
+	auto performReadTask(const process::ExecutionContext &context) -> void;
+
+	/// @brief Invalidates the read data of all the I/O transactions
+	auto invalidateData(std::chrono::system_clock::time_point timeStamp) -> void;
+
+	/// @name Virtual Overrides for skill::Element
+	/// @{
+
+	auto load(utils::json::decoder::Object &jsonObject, config::Context &context) -> void final;
+
+	auto prepare() -> void final;
+
+	auto cleanup() -> void final;
+
+	/// @}
+
+	/// @brief The I/O transactions of the group
+	std::vector<std::reference_wrapper<TemplateIoTransaction>> _ioTransactions;
+
+	/// @brief The maximum time to wait for the responses, or std::nullopt to wait for all the responses
+	std::optional<std::chrono::milliseconds> _deadline;
+
+	/// @brief The "read" task
+	ReadTask<TemplatePollingGroup> _readTask { *this };
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,152 @@
+// Copyright (c) embedded ocean GmbH
+#include "ThreadOptions.hpp"
+
+#include <xentara/utils/json/decoder/Errors.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <system_error>
+
+#if defined(__linux__)
+#	include <pthread.h>
+#	include <sched.h>
+#	include <sys/mman.h>
+#	include <time.h>
+#	include <cerrno>
+#endif
+
+namespace xentara::plugins::templateDriver
+{
+
+auto loadThreadCpus(utils::json::decoder::Value &value) -> std::vector<std::size_t>
+{
+	std::vector<std::size_t> cpus;
+	for (auto &&element : value.asArray())
+	{
+		cpus.push_back(element.asNumber<std::size_t>());
+	}
+
+	if (cpus.empty())
+	{
+		/// @todo replace "template I/O component" with a more descriptive name
+		utils::json::decoder::throwWithLocation(value, std::runtime_error("list of thread CPUs of template I/O component must not be empty"));
+	}
+
+	return cpus;
+}
+
+auto loadThreadPriority(utils::json::decoder::Value &value) -> int
+{
+	// Linux supports SCHED_FIFO priorities from 1 to 99
+	const auto priority = value.asNumber<int>();
+	if (priority < 1 || priority > 99)
+	{
+		/// @todo replace "template I/O component" with a more descriptive name
+		utils::json::decoder::throwWithLocation(value, std::runtime_error("thread priority of template I/O component must be between 1 and 99"));
+	}
+
+	return priority;
+}
+
+auto loadThreadName(utils::json::decoder::Value &value) -> std::string
+{
+	auto name = value.asString<std::string>();
+	if (name.empty() || name.size() > kMaxThreadNameLength)
+	{
+		/// @todo replace "template I/O component" with a more descriptive name
+		utils::json::decoder::throwWithLocation(value,
+			std::runtime_error("thread name of template I/O component must have between 1 and 15 characters"));
+	}
+
+	return name;
+}
+
+#if defined(__linux__)
+
+auto applyThreadOptions(std::thread &thread, const ThreadOptions &options, std::string_view nameSuffix) -> void
+{
+	const auto handle = thread.native_handle();
+
+	// Set the name. A failure here is not fatal, so the result is ignored.
+	if (!options._name.empty())
+	{
+		auto name = options._name;
+		name.append(nameSuffix);
+		name.resize(std::min(name.size(), kMaxThreadNameLength));
+		::pthread_setname_np(handle, name.c_str());
+	}
+
+	// Restrict the thread to the configured CPUs
+	if (!options._cpus.empty())
+	{
+		::cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+		for (auto &&cpu : options._cpus)
+		{
+			if (cpu >= CPU_SETSIZE)
+			{
+				throw std::system_error(EINVAL, std::generic_category(), "invalid thread CPU");
+			}
+			CPU_SET(cpu, &cpuSet);
+		}
+		if (const auto result = ::pthread_setaffinity_np(handle, sizeof(cpuSet), &cpuSet); result != 0)
+		{
+			throw std::system_error(result, std::generic_category(), "could not set the CPU affinity of a thread");
+		}
+	}
+
+	// Use the real-time scheduling policy
+	if (options._priority)
+	{
+		::sched_param parameters {};
+		parameters.sched_priority = *options._priority;
+		if (const auto result = ::pthread_setschedparam(handle, SCHED_FIFO, &parameters); result != 0)
+		{
+			throw std::system_error(result, std::generic_category(), "could not set the scheduling policy of a thread");
+		}
+	}
+
+	// Lock the memory of the process. This affects the entire process, and only needs to be done once, but repeating it is harmless.
+	if (options._lockMemory)
+	{
+		if (::mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+		{
+			throw std::system_error(errno, std::generic_category(), "could not lock the memory of the process");
+		}
+	}
+}
+
+auto currentThreadCpuTime() noexcept -> double
+{
+	::timespec time {};
+	if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0)
+	{
+		return 0.0;
+	}
+
+	return double(time.tv_sec) + double(time.tv_nsec) * 1e-9;
+}
+
+#else // defined(__linux__)
+
+auto applyThreadOptions([[maybe_unused]] std::thread &thread, const ThreadOptions &options, [[maybe_unused]] std::string_view nameSuffix)
+	-> void
+{
+	/// @todo implement the thread options for other operating systems, if needed
+
+	// Thread names are cosmetic, but the other options must not be silently ignored
+	if (!options._cpus.empty() || options._priority || options._lockMemory)
+	{
+		throw std::system_error(std::make_error_code(std::errc::not_supported), "thread options are not supported on this platform");
+	}
+}
+
+auto currentThreadCpuTime() noexcept -> double
+{
+	/// @todo implement for other operating systems, if needed
+	return 0.0;
+}
+
+#endif // defined(__linux__)
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,57 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <xentara/utils/json/decoder/Value.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief Options for the threads owned by the driver
+///
+/// These options allow the I/O worker and decode threads to be isolated from the CPUs used by the Xentara scheduler
+/// on real-time systems.
+struct ThreadOptions final
+{
+	/// @brief The CPUs the thread may run on, or an empty list to let it run on any CPU
+	std::vector<std::size_t> _cpus;
+	/// @brief The SCHED_FIFO priority of the thread, or std::nullopt to use the default scheduling policy
+	std::optional<int> _priority;
+	/// @brief Whether all the memory of the process should be locked into RAM, so that the thread does not incur page faults
+	bool _lockMemory { false };
+	/// @brief The name of the thread, as shown by tools like *top* or *ps*
+	std::string _name;
+};
+
+/// @brief The maximum length of a thread name. This is the limit imposed by Linux.
+constexpr std::size_t kMaxThreadNameLength = 15;
+
+/// @brief Loads a list of CPUs from a JSON value
+/// @param value The JSON value, which must be an array of CPU numbers
+auto loadThreadCpus(utils::json::decoder::Value &value) -> std::vector<std::size_t>;
+
+/// @brief Loads a SCHED_FIFO thread priority from a JSON value
+auto loadThreadPriority(utils::json::decoder::Value &value) -> int;
+
+/// @brief Loads a thread name from a JSON value
+auto loadThreadName(utils::json::decoder::Value &value) -> std::string;
+
+/// @brief Applies thread options to a running thread
+///
+/// The options that are not supported by the operating system are ignored if they are not set.
+/// @param thread The thread
+/// @param options The options to apply
+/// @param nameSuffix A suffix to append to the name of the thread. The name is truncated to kMaxThreadNameLength characters.
+/// @throw std::system_error The options could not be applied, e.g. because the process lacks the necessary privileges
+auto applyThreadOptions(std::thread &thread, const ThreadOptions &options, std::string_view nameSuffix = {}) -> void;
+
+/// @brief Gets the CPU time used by the calling thread so far, in seconds
+auto currentThreadCpuTime() noexcept -> double;
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,182 @@
+// Copyright (c) embedded ocean GmbH
+#include "TimingStatistics.hpp"
+
+#include "Attributes.hpp"
+
+#include <array>
+#include <utility>
+
+namespace xentara::plugins::templateDriver
+{
+
+namespace
+{
+
+/// @brief The attributes of a histogram, in the order of LatencyHistogram::Statistic
+using HistogramAttributes = std::array<const model::Attribute *, 4>;
+
+/// @brief The attributes of the read duration histogram
+const HistogramAttributes kReadDurationAttributes {
+	&attributes::kReadDurationP50, &attributes::kReadDurationP99, &attributes::kReadDurationP999, &attributes::kReadDurationMax
+};
+/// @brief The attributes of the write duration histogram
+const HistogramAttributes kWriteDurationAttributes {
+	&attributes::kWriteDurationP50, &attributes::kWriteDurationP99, &attributes::kWriteDurationP999, &attributes::kWriteDurationMax
+};
+/// @brief The attributes of the start lag histogram
+const HistogramAttributes kStartLagAttributes {
+	&attributes::kStartLagP50, &attributes::kStartLagP99, &attributes::kStartLagP999, &attributes::kStartLagMax
+};
+
+/// @brief The attributes containing the average time of each read phase, in the order of ReadPhase
+const std::array<const model::Attribute *, kReadPhaseCount> kReadPhaseAverageAttributes {
+	&attributes::kReadSubmitTimeMean, &attributes::kReadWaitTimeMean, &attributes::kDecodeTimeMean, &attributes::kValueUpdateTimeMean, &attributes::kCommitTimeMean
+};
+/// @brief The attributes containing the maximum time of each read phase, in the order of ReadPhase
+const std::array<const model::Attribute *, kReadPhaseCount> kReadPhaseMaximumAttributes {
+	&attributes::kReadSubmitTimeMax, &attributes::kReadWaitTimeMax, &attributes::kDecodeTimeMax, &attributes::kValueUpdateTimeMax, &attributes::kCommitTimeMax
+};
+
+/// @brief Calls a function for each attribute in a list
+template <std::size_t kCount>
+auto forEachListedAttribute(const std::array<const model::Attribute *, kCount> &attributes, const model::ForEachAttributeFunction &function) -> bool
+{
+	for (auto &&attribute : attributes)
+	{
+		if (function(*attribute))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/// @brief Creates a read handle for an attribute in a list, using the value with the same index
+template <typename Value, std::size_t kCount>
+auto makeListedReadHandle(const std::array<const model::Attribute *, kCount> &attributes,
+	const std::array<Value, kCount> &values,
+	const model::Attribute &attribute) noexcept -> std::optional<data::ReadHandle>
+{
+	for (std::size_t index = 0; index < kCount; ++index)
+	{
+		if (attribute == *attributes[index])
+		{
+			return data::ReadHandle { values[index] };
+		}
+	}
+
+	return std::nullopt;
+}
+
+/// @brief Creates a read handle for an attribute of a histogram
+auto makeHistogramReadHandle(
+	const LatencyHistogram &histogram, const HistogramAttributes &attributes, const model::Attribute &attribute) noexcept
+	-> std::optional<data::ReadHandle>
+{
+	for (std::size_t index = 0; index < attributes.size(); ++index)
+	{
+		if (attribute == *attributes[index])
+		{
+			return data::ReadHandle { histogram.statistic(LatencyHistogram::Statistic(index)) };
+		}
+	}
+
+	return std::nullopt;
+}
+
+} // namespace
+
+auto TimingStatistics::recordReadPhases(const ReadPhaseTimes &phaseTimes) noexcept -> void
+{
+	for (std::size_t index = 0; index < kReadPhaseCount; ++index)
+	{
+		const auto seconds = CycleClock::toSeconds(phaseTimes[ReadPhase(index)]);
+
+		// Use an exponential moving average, so that the value reflects the recent behaviour
+		auto &average = _readPhaseAverages[index];
+		const auto previous = average.load(std::memory_order_relaxed);
+		average.store(previous + (seconds - previous) * kSmoothingFactor, std::memory_order_relaxed);
+
+		auto &maximum = _readPhaseMaxima[index];
+		if (seconds > maximum.load(std::memory_order_relaxed))
+		{
+			maximum.store(seconds, std::memory_order_relaxed);
+		}
+	}
+}
+
+auto TimingStatistics::forEachAttribute(const model::ForEachAttributeFunction &function) const -> bool
+{
+	return
+		forEachListedAttribute(kReadDurationAttributes, function) ||
+		forEachListedAttribute(kWriteDurationAttributes, function) ||
+		forEachListedAttribute(kStartLagAttributes, function) ||
+		forEachListedAttribute(kReadPhaseAverageAttributes, function) ||
+		forEachListedAttribute(kReadPhaseMaximumAttributes, function) ||
+		function(attributes::kResetTimingStatistics);
+}
+
+auto TimingStatistics::makeReadHandle(const model::Attribute &attribute) const noexcept -> std::optional<data::ReadHandle>
+{
+	if (auto handle = makeHistogramReadHandle(_readDurations, kReadDurationAttributes, attribute))
+	{
+		return handle;
+	}
+	if (auto handle = makeHistogramReadHandle(_writeDurations, kWriteDurationAttributes, attribute))
+	{
+		return handle;
+	}
+	if (auto handle = makeHistogramReadHandle(_startLags, kStartLagAttributes, attribute))
+	{
+		return handle;
+	}
+	if (auto handle = makeListedReadHandle(kReadPhaseAverageAttributes, _readPhaseAverages, attribute))
+	{
+		return handle;
+	}
+	if (auto handle = makeListedReadHandle(kReadPhaseMaximumAttributes, _readPhaseMaxima, attribute))
+	{
+		return handle;
+	}
+
+	return std::nullopt;
+}
+
+auto TimingStatistics::makeWriteHandle(const model::Attribute &attribute, std::shared_ptr<void> parent) noexcept
+	-> std::optional<data::WriteHandle>
+{
+	if (attribute == attributes::kResetTimingStatistics)
+	{
+		// Make a shared pointer that refers to the statistics
+		std::shared_ptr<TimingStatistics> sharedThis(std::move(parent), this);
+
+		// Create a write handle of type bool that calls reset() on sharedThis.
+		// (There are two sets of braces needed here: one for data::WriteHandle, and one for std::optional)
+		return {{ std::in_place_type<bool>, &TimingStatistics::reset, sharedThis }};
+	}
+
+	return std::nullopt;
+}
+
+auto TimingStatistics::reset(bool reset) noexcept -> void
+{
+	if (!reset)
+	{
+		return;
+	}
+
+	_readDurations.reset();
+	_writeDurations.reset();
+	_startLags.reset();
+	for (auto &&average : _readPhaseAverages)
+	{
+		average.store(0.0, std::memory_order_relaxed);
+	}
+	for (auto &&maximum : _readPhaseMaxima)
+	{
+		maximum.store(0.0, std::memory_order_relaxed);
+	}
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,96 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "LatencyHistogram.hpp"
+#include "ReadPhaseTimes.hpp"
+
+#include <xentara/data/ReadHandle.hpp>
+#include <xentara/data/WriteHandle.hpp>
+#include <xentara/model/Attribute.hpp>
+#include <xentara/model/ForEachAttributeFunction.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief Timing statistics for the tasks of an I/O transaction
+///
+/// The statistics contain histograms of the read durations, the write durations, and the time between the scheduled and
+/// the actual start of the tasks. The percentiles of the histograms are published as attributes, so that cycle times
+/// can be sized using measurements from the production system.
+///
+/// In addition, the average and maximum time of each phase of a read are published, so that the cause of an overrun
+/// can be narrowed down to the I/O component, the decoding, or the events.
+class TimingStatistics final
+{
+public:
+	/// @brief Records the time a read took
+	auto recordReadDuration(std::chrono::nanoseconds duration) noexcept -> void
+	{
+		_readDurations.record(duration);
+	}
+
+	/// @brief Records the time a write took
+	auto recordWriteDuration(std::chrono::nanoseconds duration) noexcept -> void
+	{
+		_writeDurations.record(duration);
+	}
+
+	/// @brief Records the time spent in each phase of a read
+	auto recordReadPhases(const ReadPhaseTimes &phaseTimes) noexcept -> void;
+
+	/// @brief Records how late a task started
+	/// @param scheduledTime The time the task was scheduled to start
+	auto recordStartLag(std::chrono::system_clock::time_point scheduledTime) noexcept -> void
+	{
+		_startLags.record(std::chrono::system_clock::now() - scheduledTime);
+	}
+
+	/// @brief Iterates over all the attributes that belong to the statistics.
+	/// @param function The function that should be called for each attribute
+	/// @return The return value of the last function call
+	auto forEachAttribute(const model::ForEachAttributeFunction &function) const -> bool;
+
+	/// @brief Creates a read-handle for an attribute that belongs to the statistics.
+	/// @param attribute The attribute to create the handle for
+	/// @return A read handle for the attribute, or std::nullopt if the attribute is unknown
+	auto makeReadHandle(const model::Attribute &attribute) const noexcept -> std::optional<data::ReadHandle>;
+
+	/// @brief Creates a write-handle for an attribute that belongs to the statistics.
+	/// @param attribute The attribute to create the handle for
+	/// @param parent
+	/// @parblock
+	/// A shared pointer to the containing object.
+	/// 
+	/// The pointer is used in the aliasing constructor of std::shared_ptr when constructing the write handle,
+	/// so that it will share ownership information with pointers to the parent object.
+	/// @endparblock
+	/// @return A write handle for the attribute, or std::nullopt if the attribute is unknown
+	auto makeWriteHandle(const model::Attribute &attribute, std::shared_ptr<void> parent) noexcept -> std::optional<data::WriteHandle>;
+
+private:
+	/// @brief Resets all the histograms, if *true* was written to the reset attribute
+	auto reset(bool reset) noexcept -> void;
+
+	/// @brief The durations of the reads
+	LatencyHistogram _readDurations;
+	/// @brief The durations of the writes
+	LatencyHistogram _writeDurations;
+	/// @brief The start lags of the tasks
+	LatencyHistogram _startLags;
+
+	/// @brief The weight of each new sample in the moving averages of the read phases
+	static constexpr double kSmoothingFactor = 1.0 / 16.0;
+
+	/// @brief The average time spent in each phase of a read, in seconds
+	std::array<std::atomic<double>, kReadPhaseCount> _readPhaseAverages {};
+	/// @brief The maximum time spent in each phase of a read, in seconds
+	std::array<std::atomic<double>, kReadPhaseCount> _readPhaseMaxima {};
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
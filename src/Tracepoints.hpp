@@ -0,0 +1,73 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+// Static user-space tracepoints (USDT) are only compiled in if enabled using the CMake option TEMPLATE_DRIVER_TRACEPOINTS.
+// An enabled tracepoint is a single nop instruction until a tracer like bpftrace or perf attaches to it.
+#if defined(TEMPLATE_DRIVER_TRACEPOINTS)
+#	include <sys/sdt.h>
+#endif
+
+#include <cstdint>
+#include <utility>
+
+/// @def TEMPLATE_DRIVER_TRACE(probe, id, pointCount, byteCount)
+/// @brief Marks a static user-space tracepoint
+///
+/// All tracepoints belong to the provider *template_driver*, and have three arguments: an ID identifying the object, usually
+/// the address of the I/O transaction, the number of data points involved, and the number of bytes involved. The arguments
+/// are not evaluated if tracepoints are disabled.
+/// @todo rename the provider to match the driver
+
+/// @def TEMPLATE_DRIVER_TRACE_SCOPE(probe, id, pointCount, byteCount)
+/// @brief Marks a pair of static user-space tracepoints at the entry and the exit of a scope
+///
+/// The tracepoints are called *probe*_entry and *probe*_return, and have the same arguments as the ones of
+/// TEMPLATE_DRIVER_TRACE. The arguments are evaluated on entry, and passed to both tracepoints. They are evaluated twice,
+/// so they must not have side effects. Only one scope can be traced per block.
+
+#if defined(TEMPLATE_DRIVER_TRACEPOINTS)
+#	define TEMPLATE_DRIVER_TRACE(probe, id, pointCount, byteCount) \
+		DTRACE_PROBE3(template_driver, probe, (id), std::uint64_t(pointCount), std::uint64_t(byteCount))
+#	define TEMPLATE_DRIVER_TRACE_SCOPE(probe, id, pointCount, byteCount) \
+		TEMPLATE_DRIVER_TRACE(probe##_entry, id, pointCount, byteCount); \
+		const ::xentara::plugins::templateDriver::TraceScopeExit templateDriverTraceScopeExit( \
+			[templateDriverTraceId = (id), templateDriverTracePoints = std::uint64_t(pointCount), templateDriverTraceBytes = std::uint64_t(byteCount)]() noexcept \
+			{ \
+				TEMPLATE_DRIVER_TRACE(probe##_return, templateDriverTraceId, templateDriverTracePoints, templateDriverTraceBytes); \
+			})
+#else
+#	define TEMPLATE_DRIVER_TRACE(probe, id, pointCount, byteCount) ((void)0)
+#	define TEMPLATE_DRIVER_TRACE_SCOPE(probe, id, pointCount, byteCount) ((void)0)
+#endif
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief Calls a function when it goes out of scope. This is used by TEMPLATE_DRIVER_TRACE_SCOPE to mark the exit of the scope.
+template <typename Function>
+class TraceScopeExit final
+{
+public:
+	/// @brief Constructor
+	/// @param function The function to call on exit
+	explicit TraceScopeExit(Function function) noexcept : _function(std::move(function))
+	{
+	}
+
+	/// @brief The destructor calls the function
+	~TraceScopeExit()
+	{
+		_function();
+	}
+
+	/// @brief Not copyable
+	TraceScopeExit(const TraceScopeExit &) = delete;
+	/// @brief Not copyable
+	auto operator=(const TraceScopeExit &) -> TraceScopeExit & = delete;
+
+private:
+	/// @brief The function to call on exit
+	Function _function;
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
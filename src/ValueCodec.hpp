@@ -0,0 +1,151 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "ByteOrder.hpp"
+
+#include <xentara/utils/tools/Concepts.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+namespace xentara::plugins::templateDriver
+{
+
+namespace detail
+{
+
+	/// @brief The unsigned integer type with a specific size
+	template <std::size_t kSize>
+	struct UnsignedOfSize;
+
+	/// @brief Specialization for 1 byte
+	template <>
+	struct UnsignedOfSize<1>
+	{
+		using type = std::uint8_t;
+	};
+	/// @brief Specialization for 2 bytes
+	template <>
+	struct UnsignedOfSize<2>
+	{
+		using type = std::uint16_t;
+	};
+	/// @brief Specialization for 4 bytes
+	template <>
+	struct UnsignedOfSize<4>
+	{
+		using type = std::uint32_t;
+	};
+	/// @brief Specialization for 8 bytes
+	template <>
+	struct UnsignedOfSize<8>
+	{
+		using type = std::uint64_t;
+	};
+
+	/// @brief Stores an unsigned integer with a specific byte order
+	template <std::unsigned_integral Integer>
+	auto storeInteger(Integer value, std::span<std::byte> data, ByteOrder byteOrder) noexcept -> void
+	{
+		const auto raw = fromNativeByteOrder(value, byteOrder);
+		std::memcpy(data.data(), &raw, sizeof(raw));
+	}
+
+	/// @brief Stores an integer value in as many bytes as there are in the data, truncating it if necessary
+	template <std::integral Integer>
+	auto storeTruncatedInteger(Integer value, std::span<std::byte> data, ByteOrder byteOrder) noexcept -> void
+	{
+		// Convert to unsigned first, so that negative values are truncated correctly
+		const auto bits = std::make_unsigned_t<Integer>(value);
+		switch (data.size())
+		{
+		case 1:
+			storeInteger(std::uint8_t(bits), data, byteOrder);
+			break;
+		case 2:
+			storeInteger(std::uint16_t(bits), data, byteOrder);
+			break;
+		case 4:
+			storeInteger(std::uint32_t(bits), data, byteOrder);
+			break;
+		case 8:
+			storeInteger(std::uint64_t(bits), data, byteOrder);
+			break;
+		}
+	}
+
+} // namespace detail
+
+/// @brief Decodes a Boolean or string value from the data received from the I/O component
+///
+/// Integer and floating point values are not decoded individually, but in runs using the kernels in DecodeKernels.hpp.
+/// @param data The data of the value. The data must be exactly as large as the size configured for the data point.
+/// @param byteOrder The byte order of the data
+/// @return The decoded value
+/// @todo adapt the decoding to the data format of the I/O component
+template <typename ValueType>
+auto decodeValue(std::span<const std::byte> data, [[maybe_unused]] ByteOrder byteOrder) -> ValueType
+{
+	// Booleans are true if any of the bytes is set
+	if constexpr (std::same_as<ValueType, bool>)
+	{
+		return std::ranges::any_of(data, [](std::byte byte) { return byte != std::byte { 0 }; });
+	}
+	// Strings are padded with NUL characters
+	else
+	{
+		static_assert(utils::tools::StringType<ValueType>, "integer and floating point values must be decoded using the kernels");
+
+		using Char = typename ValueType::value_type;
+
+		const auto begin = reinterpret_cast<const Char *>(data.data());
+		const auto end = begin + data.size() / sizeof(Char);
+		return ValueType(begin, std::find(begin, end, Char(0)));
+	}
+}
+
+/// @brief Encodes a value into the data to send to the I/O component
+/// @param value The value to encode
+/// @param data The destination. The data must be exactly as large as the size configured for the data point.
+/// @param byteOrder The byte order of the data
+/// @todo adapt the encoding to the data format of the I/O component
+template <typename ValueType>
+auto encodeValue(const ValueType &value, std::span<std::byte> data, [[maybe_unused]] ByteOrder byteOrder) noexcept -> void
+{
+	// Booleans are stored as integers with the value 0 or 1
+	if constexpr (std::same_as<ValueType, bool>)
+	{
+		detail::storeTruncatedInteger(std::uint8_t(value ? 1 : 0), data, byteOrder);
+	}
+	// Integers may be stored in fewer bytes than their type has
+	else if constexpr (utils::tools::Integral<ValueType>)
+	{
+		detail::storeTruncatedInteger(value, data, byteOrder);
+	}
+	// Floating point values are stored as their IEEE 754 bit pattern
+	else if constexpr (std::floating_point<ValueType>)
+	{
+		using Unsigned = typename detail::UnsignedOfSize<sizeof(ValueType)>::type;
+		detail::storeInteger(std::bit_cast<Unsigned>(value), data, byteOrder);
+	}
+	// Strings are truncated or padded with NUL characters
+	else
+	{
+		static_assert(utils::tools::StringType<ValueType>, "unsupported value type");
+
+		using Char = typename ValueType::value_type;
+
+		const auto begin = reinterpret_cast<Char *>(data.data());
+		const auto end = begin + data.size() / sizeof(Char);
+		const auto copied = std::copy_n(value.begin(), std::min(value.size(), std::size_t(end - begin)), begin);
+		std::fill(copied, end, Char(0));
+	}
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,76 @@
+// Copyright (c) embedded ocean GmbH
+#include "WriteCommand.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <tuple>
+
+namespace xentara::plugins::templateDriver
+{
+
+auto WriteCommand::reset(std::size_t valueCount, std::size_t dataSize) -> void
+{
+	_staging.assign(dataSize, std::byte { 0 });
+	_data.assign(dataSize, std::byte { 0 });
+	_entries.clear();
+	_entries.reserve(valueCount);
+	_blocks.clear();
+	_blocks.reserve(valueCount);
+	_stagingSize = 0;
+}
+
+auto WriteCommand::clear() noexcept -> void
+{
+	_entries.clear();
+	_blocks.clear();
+	_stagingSize = 0;
+}
+
+auto WriteCommand::addEntry(std::uint64_t address, std::size_t size) -> std::span<std::byte>
+{
+	// Make sure the buffers are large enough, so we never allocate memory here
+	if (_entries.size() == _entries.capacity() || size > _staging.size() - _stagingSize) [[unlikely]]
+	{
+		throw std::logic_error("internal error: xentara::plugins::templateDriver::WriteCommand::addEntry() called with too much data");
+	}
+
+	_entries.push_back({ address, size, _stagingSize, _entries.size() });
+	const auto staging = std::span(_staging).subspan(_stagingSize, size);
+	_stagingSize += size;
+
+	return staging;
+}
+
+auto WriteCommand::plan(const WriteLimits &limits) -> void
+{
+	_blocks.clear();
+
+	// Sort the entries by address. Values at the same address keep the order they were added in.
+	std::ranges::sort(_entries, {}, [](const Entry &entry) { return std::tuple(entry._address, entry._index); });
+
+	// Merge adjacent entries into blocks, copying the data into address order
+	std::size_t dataSize = 0;
+	for (std::size_t index = 0; index < _entries.size(); ++index)
+	{
+		const auto &entry = _entries[index];
+
+		// Append the entry to the current block if it directly follows it, and the limits allow it
+		auto *block = _blocks.empty() ? nullptr : &_blocks.back();
+		const auto append = block &&
+			entry._address == block->_address + block->_size &&
+			block->_size + entry._size <= limits._maxSize &&
+			block->_entryCount < limits._maxValueCount;
+		if (!append)
+		{
+			block = &_blocks.emplace_back(Block { entry._address, dataSize, 0, index, 0, {} });
+		}
+
+		std::memcpy(_data.data() + dataSize, _staging.data() + entry._offset, entry._size);
+		dataSize += entry._size;
+		block->_size += entry._size;
+		++block->_entryCount;
+	}
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -1,15 +1,133 @@
 // Copyright (c) embedded ocean GmbH
 #pragma once
 
+#include "DataAddress.hpp"
+#include "ValueCodec.hpp"
+#include "WriteLimits.hpp"
+
 #include <xentara/utils/tools/Unique.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+#include <vector>
+
 namespace xentara::plugins::templateDriver
 {
 
 /// @brief A command used to write outputs
-/// @todo implement a proper write command
+///
+/// The outputs first add their values to the command in any order. The command then sorts the values by address, and merges
+/// values at adjacent addresses into blocks, each of which can be written using a single request. Values that have no neighbours
+/// get a block of their own.
+///
+/// All the buffers are allocated by reset(), so that no memory needs to be allocated when the command is used.
+/// @todo adapt this to the write requests of the I/O component
 class WriteCommand final : private utils::tools::Unique
 {
+public:
+	/// @brief A value added to the command
+	struct Entry final
+	{
+		/// @brief The address of the value
+		std::uint64_t _address { 0 };
+		/// @brief The size of the value, in bytes
+		std::size_t _size { 0 };
+		/// @brief The offset of the encoded value within the staging buffer
+		std::size_t _offset { 0 };
+		/// @brief The position in which the value was added, starting with 0
+		std::size_t _index { 0 };
+	};
+
+	/// @brief A block of values at contiguous addresses that is written using a single request
+	struct Block final
+	{
+		/// @brief The address of the first byte
+		std::uint64_t _address { 0 };
+		/// @brief The offset of the data within the data buffer
+		std::size_t _offset { 0 };
+		/// @brief The number of bytes to write
+		std::size_t _size { 0 };
+		/// @brief The index of the first entry in the block
+		std::size_t _firstEntry { 0 };
+		/// @brief The number of entries in the block
+		std::size_t _entryCount { 0 };
+		/// @brief The error that occurred writing the block, or a default constructed std::error_code object if no error occurred
+		std::error_code _error;
+	};
+
+	/// @brief Allocates the buffers, and clears the command
+	/// @param valueCount The maximum number of values that will be added
+	/// @param dataSize The maximum total size of all the values that will be added
+	auto reset(std::size_t valueCount, std::size_t dataSize) -> void;
+
+	/// @brief Removes all the values
+	auto clear() noexcept -> void;
+
+	/// @brief Adds a value to the command
+	/// @param address The address of the value. The size must match the one used for reset().
+	/// @param value The value to add
+	template <typename ValueType>
+	auto add(const DataAddress &address, const ValueType &value) -> void
+	{
+		encodeValue(value, addEntry(address._address, address._size), address._byteOrder);
+	}
+
+	/// @brief Sorts the values by address, and merges them into blocks
+	/// @param limits The limits of the I/O component
+	auto plan(const WriteLimits &limits) -> void;
+
+	/// @brief Checks whether there are no values in the command
+	auto empty() const noexcept -> bool
+	{
+		return _entries.empty();
+	}
+
+	/// @brief Gets the total size of all the values
+	auto dataSize() const noexcept -> std::size_t
+	{
+		return _stagingSize;
+	}
+
+	/// @brief Gets the blocks. This is only valid after plan() was called.
+	auto blocks() noexcept -> std::span<Block>
+	{
+		return _blocks;
+	}
+	/// @overload
+	auto blocks() const noexcept -> std::span<const Block>
+	{
+		return _blocks;
+	}
+
+	/// @brief Gets the data to write for a block
+	auto data(const Block &block) const noexcept -> std::span<const std::byte>
+	{
+		return std::span(_data).subspan(block._offset, block._size);
+	}
+
+	/// @brief Gets the entries for the values in a block
+	auto entries(const Block &block) const noexcept -> std::span<const Entry>
+	{
+		return std::span(_entries).subspan(block._firstEntry, block._entryCount);
+	}
+
+private:
+	/// @brief Adds an entry, and returns the staging buffer area to encode the value into
+	auto addEntry(std::uint64_t address, std::size_t size) -> std::span<std::byte>;
+
+	/// @brief The encoded values, in the order they were added
+	std::vector<std::byte> _staging;
+	/// @brief The number of bytes of the staging buffer that are in use
+	std::size_t _stagingSize { 0 };
+	/// @brief The encoded values, sorted by address
+	std::vector<std::byte> _data;
+
+	/// @brief The values. These are sorted by plan().
+	std::vector<Entry> _entries;
+	/// @brief The blocks created by plan()
+	std::vector<Block> _blocks;
 };
 
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,21 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <cstddef>
+#include <limits>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief The limits the I/O component imposes on a single write request
+/// @todo adapt this to the limits of the I/O component
+struct WriteLimits final
+{
+	/// @brief The maximum number of bytes a single write request can write
+	/// @todo use the maximum payload size of the I/O component
+	std::size_t _maxSize { std::numeric_limits<std::size_t>::max() };
+	/// @brief The maximum number of values a single write request can write
+	std::size_t _maxValueCount { std::numeric_limits<std::size_t>::max() };
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file